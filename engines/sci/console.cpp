@@ -35,6 +35,7 @@
 #include "sci/engine/gc.h"
 #include "sci/engine/features.h"
 #include "sci/engine/scriptdebug.h"
+#include "sci/engine/script_patches.h"
 #include "sci/sound/midiparser_sci.h"
 #include "sci/sound/music.h"
 #include "sci/sound/drivers/mididriver.h"
@@ -54,6 +55,7 @@
 #include "sci/video/seq_decoder.h"
 #ifdef ENABLE_SCI32
 #include "common/memstream.h"
+#include "sci/graphics/celobj32.h"
 #include "sci/graphics/frameout.h"
 #include "sci/graphics/paint32.h"
 #include "sci/graphics/palette32.h"
@@ -119,6 +121,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("alloc_list",				WRAP_METHOD(Console, cmdAllocList));
 	registerCmd("hexgrep",			WRAP_METHOD(Console, cmdHexgrep));
 	registerCmd("verify_scripts",		WRAP_METHOD(Console, cmdVerifyScripts));
+	registerCmd("bench_script_patches",	WRAP_METHOD(Console, cmdBenchScriptPatches));
 	registerCmd("integrity_dump",	WRAP_METHOD(Console, cmdResourceIntegrityDump));
 	// Game
 	registerCmd("save_game",			WRAP_METHOD(Console, cmdSaveGame));
@@ -133,6 +136,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("set_palette",		WRAP_METHOD(Console, cmdSetPalette));
 	registerCmd("draw_pic",			WRAP_METHOD(Console, cmdDrawPic));
 	registerCmd("draw_cel",			WRAP_METHOD(Console, cmdDrawCel));
+	registerCmd("bench_cel",          WRAP_METHOD(Console, cmdBenchCel));
 	registerCmd("undither",           WRAP_METHOD(Console, cmdUndither));
 	registerCmd("pic_visualize",		WRAP_METHOD(Console, cmdPicVisualize));
 	registerCmd("play_video",         WRAP_METHOD(Console, cmdPlayVideo));
@@ -148,6 +152,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("pi",                 WRAP_METHOD(Console, cmdPlaneItemList));	// alias
 	registerCmd("visible_plane_items", WRAP_METHOD(Console, cmdVisiblePlaneItemList));
 	registerCmd("vpi",                WRAP_METHOD(Console, cmdVisiblePlaneItemList));	// alias
+	registerCmd("frame_stats",        WRAP_METHOD(Console, cmdFrameStats));
 	registerCmd("saved_bits",         WRAP_METHOD(Console, cmdSavedBits));
 	registerCmd("show_saved_bits",    WRAP_METHOD(Console, cmdShowSavedBits));
 	// Segments
@@ -340,6 +345,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" alloc_list - Lists all allocated resources\n");
 	debugPrintf(" hexgrep - Searches some resources for a particular sequence of bytes, represented as hexadecimal numbers\n");
 	debugPrintf(" verify_scripts - Performs sanity checks on SCI1.1-SCI2.1 game scripts (e.g. if they're up to 64KB in total)\n");
+	debugPrintf(" bench_script_patches - Measures the time taken to patch all scripts of the game\n");
 	debugPrintf(" integrity_dump - Dumps integrity data about resources in the current game to disk\n");
 	debugPrintf("\n");
 	debugPrintf("Game:\n");
@@ -356,6 +362,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" set_palette - Sets a palette resource\n");
 	debugPrintf(" draw_pic - Draws a pic resource\n");
 	debugPrintf(" draw_cel - Draws a cel from a view resource\n");
+	debugPrintf(" bench_cel - Measures the time taken to render a cel from a view resource (SCI2+)\n");
 	debugPrintf(" pic_visualize - Enables visualization of the drawing process of EGA pictures\n");
 	debugPrintf(" undither - Enable/disable undithering\n");
 	debugPrintf(" play_video - Plays a SEQ, AVI, VMD, RBT or DUK video\n");
@@ -365,6 +372,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" visible_plane_list / vpl - Shows a list of all the planes in the visible draw list (SCI2+)\n");
 	debugPrintf(" plane_items / pi - Shows a list of all items for a plane (SCI2+)\n");
 	debugPrintf(" visible_plane_items / vpi - Shows a list of all items for a plane in the visible draw list (SCI2+)\n");
+	debugPrintf(" frame_stats - Shows rendering statistics for the last frame (SCI2+)\n");
 	debugPrintf(" saved_bits - List saved bits on the hunk\n");
 	debugPrintf(" show_saved_bits - Display saved bits\n");
 	debugPrintf("\n");
@@ -1202,6 +1210,73 @@ bool Console::cmdVerifyScripts(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdBenchScriptPatches(int argc, const char **argv) {
+	if (argc > 2) {
+		debugPrintf("Measures the time taken to find and apply the script patches of all game scripts\n");
+		debugPrintf("Usage: %s [<iterations>]\n", argv[0]);
+		return true;
+	}
+
+	const int iterations = argc > 1 ? MAX(1, atoi(argv[1])) : 10;
+	ResourceManager *resMan = _engine->getResMan();
+	ScriptPatcher *scriptPatcher = _engine->getScriptPatcher();
+
+	Common::List<ResourceId> resources = resMan->listResources(kResourceTypeScript);
+	Common::sort(resources.begin(), resources.end());
+
+	// Scripts are combined with their heaps the same way Script::load does it
+	Common::Array<uint16> scriptNumbers;
+	Common::Array<Common::Array<byte> > scripts;
+	uint32 totalSize = 0;
+	for (Common::List<ResourceId>::iterator itr = resources.begin(); itr != resources.end(); ++itr) {
+		Resource *script = resMan->findResource(*itr, false);
+		if (!script)
+			continue;
+
+		uint32 scriptSize = script->size();
+		Resource *heap = nullptr;
+		if (getSciVersion() >= SCI_VERSION_1_1 && getSciVersion() <= SCI_VERSION_2_1_LATE) {
+			heap = resMan->findResource(ResourceId(kResourceTypeHeap, itr->getNumber()), false);
+			if (heap && (script->size() & 2))
+				++scriptSize;
+		}
+
+		Common::Array<byte> data;
+		data.resize(scriptSize + (heap ? heap->size() : 0));
+		script->unsafeCopyDataTo(data.begin());
+		if (heap)
+			heap->unsafeCopyDataTo(data.begin() + scriptSize);
+
+		scriptNumbers.push_back(itr->getNumber());
+		scripts.push_back(data);
+		totalSize += data.size();
+	}
+
+	debugPrintf("Patching %d scripts (%u bytes), %d iterations:\n", scripts.size(), totalSize, iterations);
+
+	Common::Array<Common::Array<byte> > buffers;
+	for (int cached = 0; cached < 2; ++cached) {
+		uint32 duration = 0;
+		for (int i = 0; i < iterations; ++i) {
+			if (!cached)
+				scriptPatcher->clearResultCache();
+
+			// Patching modifies the scripts, so always start from a fresh copy
+			buffers = scripts;
+
+			const uint32 startTime = g_system->getMillis();
+			for (uint j = 0; j < buffers.size(); ++j) {
+				scriptPatcher->processScript(scriptNumbers[j], SciSpan<byte>(buffers[j].begin(), buffers[j].size()));
+			}
+			duration += g_system->getMillis() - startTime;
+		}
+
+		debugPrintf(" %s: %u ms (%u us per pass)\n", cached ? "cached" : "searched", duration, duration * 1000 / iterations);
+	}
+
+	return true;
+}
+
 // Same as in sound/drivers/midi.cpp
 uint8 getGmInstrument(const Mt32ToGmMap &Mt32Ins) {
 	if (Mt32Ins.gmInstr == MIDI_MAPPED_TO_RHYTHM)
@@ -1970,6 +2045,82 @@ bool Console::cmdDrawCel(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdBenchCel(int argc, const char **argv) {
+	if (argc < 4) {
+		debugPrintf("Measures the time taken to render a cel from a view resource\n");
+		debugPrintf("Usage: %s <resourceId> <loopNr> <celNr> [<iterations>]\n", argv[0]);
+		debugPrintf("where <resourceId> is the number of the view resource to draw\n");
+		return true;
+	}
+
+#ifdef ENABLE_SCI32
+	if (!_engine->_gfxFrameout) {
+		debugPrintf("This SCI version does not use CelObj rendering\n");
+		return true;
+	}
+
+	const GuiResourceId viewId = atoi(argv[1]);
+	const int16 loopNo = atoi(argv[2]);
+	const int16 celNo = atoi(argv[3]);
+	const int iterations = argc > 4 ? MAX(1, atoi(argv[4])) : 1000;
+
+	if (!_engine->getResMan()->testResource(ResourceId(kResourceTypeView, viewId))) {
+		debugPrintf("View %d does not exist\n", viewId);
+		return true;
+	}
+
+	if (loopNo < 0 || loopNo >= CelObjView::getNumLoops(viewId) ||
+		celNo < 0 || celNo >= CelObjView::getNumCels(viewId, loopNo)) {
+		debugPrintf("Loop %d cel %d does not exist in view %d\n", loopNo, celNo, viewId);
+		return true;
+	}
+
+	CelObjView celObj(viewId, loopNo, celNo);
+
+	Buffer buffer;
+	buffer.create(celObj._width * 2, celObj._height * 2, Graphics::PixelFormat::createFormatCLUT8());
+
+	const struct {
+		const char *name;
+		bool mirrorX;
+		Ratio scale;
+	} modes[] = {
+		{ "unscaled", false, Ratio(1, 1) },
+		{ "unscaled, mirrored", true, Ratio(1, 1) },
+		{ "scaled 2x", false, Ratio(2, 1) },
+		{ "scaled 1/2x", false, Ratio(1, 2) }
+	};
+
+	debugPrintf("%s (%dx%d, %s, %s):\n",
+		celObj._info.toString().c_str(), celObj._width, celObj._height,
+		celObj._compressionType == kCelCompressionNone ? "uncompressed" : "compressed",
+		celObj._transparent ? "transparent" : "opaque");
+
+	for (int i = 0; i < ARRAYSIZE(modes); ++i) {
+		const Common::Rect targetRect(
+			(celObj._width * modes[i].scale).toInt(),
+			(celObj._height * modes[i].scale).toInt());
+
+		if (targetRect.isEmpty()) {
+			continue;
+		}
+
+		const uint32 startTime = g_system->getMillis();
+		for (int j = 0; j < iterations; ++j) {
+			celObj.draw(buffer, targetRect, Common::Point(0, 0), modes[i].mirrorX, modes[i].scale, modes[i].scale);
+		}
+		const uint32 duration = g_system->getMillis() - startTime;
+
+		debugPrintf(" %s: %d draws in %u ms (%u us per draw)\n", modes[i].name, iterations, duration, duration * 1000 / iterations);
+	}
+
+	buffer.free();
+#else
+	debugPrintf("SCI32 isn't included in this compiled executable\n");
+#endif
+	return true;
+}
+
 bool Console::cmdUndither(int argc, const char **argv) {
 	if (argc != 2) {
 		debugPrintf("Enable/disable undithering.\n");
@@ -2134,6 +2285,20 @@ bool Console::cmdVisiblePlaneItemList(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdFrameStats(int argc, const char **argv) {
+#ifdef ENABLE_SCI32
+	if (_engine->_gfxFrameout) {
+		debugPrintf("Frame statistics:\n");
+		_engine->_gfxFrameout->printFrameStats(this);
+	} else {
+		debugPrintf("This SCI version does not have frame statistics\n");
+	}
+#else
+	debugPrintf("SCI32 isn't included in this compiled executable\n");
+#endif
+	return true;
+}
+
 bool Console::cmdSavedBits(int argc, const char **argv) {
 	SegManager *segman = _engine->_gamestate->_segMan;
 	SegmentId id = segman->findSegmentByType(SEG_TYPE_HUNK);
@@ -936,8 +936,7 @@ Common::Error SciEngine::loadGameState(int slot) {
 
 Common::Error SciEngine::saveGameState(int slot, const Common::String &desc) {
 	Common::String fileName = Common::String::format("%s.%03d", _targetName.c_str(), slot);
-	Common::SaveFileManager *saveFileMan = g_engine->getSaveFileManager();
-	Common::OutSaveFile *out = saveFileMan->openForSaving(fileName);
+	Common::OutSaveFile *out = gamestate_openForSaving(fileName, slot);
 	const char *version = "";
 	if (!out) {
 		warning("Opening savegame \"%s\" for writing failed", fileName.c_str());
@@ -1134,10 +1134,9 @@ reg_t kSaveGame(EngineState *s, int argc, reg_t *argv) {
 	s->r_acc = NULL_REG;
 
 	Common::String filename = g_sci->getSavegameName(savegameId);
-	Common::SaveFileManager *saveFileMan = g_sci->getSaveFileManager();
 	Common::OutSaveFile *out;
 
-	out = saveFileMan->openForSaving(filename);
+	out = gamestate_openForSaving(filename, savegameId);
 	if (!out) {
 		warning("Error opening savegame \"%s\" for writing", filename.c_str());
 	} else {
@@ -1357,9 +1356,8 @@ reg_t kSaveGame32(EngineState *s, int argc, reg_t *argv) {
 		s->_segMan->freeArray(autoSaveNameId);
 	}
 
-	Common::SaveFileManager *saveFileMan = g_sci->getSaveFileManager();
 	const Common::String filename = g_sci->getSavegameName(saveNo);
-	Common::OutSaveFile *saveStream = saveFileMan->openForSaving(filename);
+	Common::OutSaveFile *saveStream = gamestate_openForSaving(filename, saveNo);
 
 	if (saveStream == nullptr) {
 		warning("Error opening savegame \"%s\" for writing", filename.c_str());
@@ -32,6 +32,7 @@
 #include "sci/event.h"
 
 #include "sci/engine/features.h"
+#include "sci/engine/file.h"
 #include "sci/engine/kernel.h"
 #include "sci/engine/state.h"
 #include "sci/engine/message.h"
@@ -1175,19 +1176,107 @@ void SegManager::reconstructClones() {
 #pragma mark -
 
 
-bool gamestate_save(EngineState *s, Common::WriteStream *fh, const Common::String &savename, const Common::String &version) {
-	Common::Serializer ser(nullptr, fh);
-	set_savegame_metadata(ser, fh, savename, version);
-	s->saveLoadWithSerializer(ser);		// FIXME: Error handling?
-	if (g_sci->_gfxPorts)
-		g_sci->_gfxPorts->saveLoadWithSerializer(ser);
-	Vocabulary *voc = g_sci->getVocabulary();
-	if (voc)
-		voc->saveLoadWithSerializer(ser);
+/**
+ * A write stream which collects the many tiny writes made by the serializer
+ * into fixed-size blocks before handing them to the save file. Without this,
+ * every single byte and word of the heap goes through a separate (virtual)
+ * write into the compressor, which is what made saving large SCI32 heaps
+ * slow. Unlike Common::wrapBufferedWriteStream, the parent stream is not
+ * owned, since callers still need to finalize it.
+ */
+class SaveBlockWriteStream : public Common::WriteStream {
+public:
+	enum {
+		kBlockSize = 64 * 1024
+	};
+
+	SaveBlockWriteStream(Common::WriteStream *parent) :
+		_parent(parent),
+		_block(new byte[kBlockSize]),
+		_blockPos(0),
+		_pos(0) {}
+
+	virtual ~SaveBlockWriteStream() {
+		flush();
+		delete[] _block;
+	}
 
-	// TODO: SSCI (at least JonesCD, presumably more) also stores the Menu state
+	virtual uint32 write(const void *dataPtr, uint32 dataSize) override {
+		const byte *data = (const byte *)dataPtr;
+		uint32 remaining = dataSize;
+		while (remaining) {
+			if (_blockPos == kBlockSize && !flush()) {
+				break;
+			}
 
-	return true;
+			const uint32 length = MIN<uint32>(remaining, kBlockSize - _blockPos);
+			memcpy(_block + _blockPos, data, length);
+			_blockPos += length;
+			data += length;
+			remaining -= length;
+		}
+
+		const uint32 written = dataSize - remaining;
+		_pos += written;
+		return written;
+	}
+
+	virtual bool flush() override {
+		if (_blockPos) {
+			const uint32 length = _blockPos;
+			_blockPos = 0;
+			if (_parent->write(_block, length) != length) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	virtual bool err() const override { return _parent->err(); }
+	virtual void clearErr() override { _parent->clearErr(); }
+	virtual int32 pos() const override { return _pos; }
+
+private:
+	Common::WriteStream *_parent;
+	byte *_block;
+	uint32 _blockPos;
+	int32 _pos;
+};
+
+bool gamestate_save(EngineState *s, Common::WriteStream *save, const Common::String &savename, const Common::String &version) {
+	const uint32 startTime = g_system->getMillis();
+
+	bool success;
+	{
+		SaveBlockWriteStream fh(save);
+		Common::Serializer ser(nullptr, &fh);
+		set_savegame_metadata(ser, &fh, savename, version);
+		s->saveLoadWithSerializer(ser);		// FIXME: Error handling?
+		if (g_sci->_gfxPorts)
+			g_sci->_gfxPorts->saveLoadWithSerializer(ser);
+		Vocabulary *voc = g_sci->getVocabulary();
+		if (voc)
+			voc->saveLoadWithSerializer(ser);
+
+		// TODO: SSCI (at least JonesCD, presumably more) also stores the Menu state
+
+		success = fh.flush() && !fh.err();
+	}
+
+	debugC(kDebugLevelFile, "Saved game state in %u ms", g_system->getMillis() - startTime);
+	return success;
+}
+
+Common::OutSaveFile *gamestate_openForSaving(const Common::String &filename, const int saveId) {
+	// Autosaves happen in the middle of gameplay, so trade disk space for
+	// speed and skip compression for them unless the user asked otherwise.
+	// Loading transparently handles both compressed and uncompressed saves.
+	bool compress = true;
+	if (saveId == kAutoSaveId) {
+		compress = ConfMan.hasKey("sci_compress_autosaves") && ConfMan.getBool("sci_compress_autosaves");
+	}
+
+	return g_sci->getSaveFileManager()->openForSaving(filename, compress);
 }
 
 extern void showScummVMDialog(const Common::String &message);
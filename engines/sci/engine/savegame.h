@@ -28,6 +28,10 @@
 
 #include "sci/sci.h"
 
+namespace Common {
+class OutSaveFile;
+}
+
 namespace Sci {
 
 struct EngineState;
@@ -105,6 +109,16 @@ struct SavegameMetadata {
  */
 bool gamestate_save(EngineState *s, Common::WriteStream *save, const Common::String &savename, const Common::String &version);
 
+/**
+ * Opens the save file for the given save game slot for writing. Autosaves are
+ * written uncompressed (unless the sci_compress_autosaves option is set) to
+ * keep them from stalling the game.
+ * @param filename	The name of the save file
+ * @param saveId	The save game slot number
+ * @return the opened save file, or nullptr on failure
+ */
+Common::OutSaveFile *gamestate_openForSaving(const Common::String &filename, const int saveId);
+
 // does a few fixups right after restoring a saved game
 void gamestate_afterRestoreFixUp(EngineState *s, int savegameId);
 
@@ -16873,10 +16873,6 @@ int32 ScriptPatcher::findSignature(uint32 magicDWord, int magicOffset, const uin
 	return -1;
 }
 
-int32 ScriptPatcher::findSignature(const SciScriptPatcherEntry *patchEntry, const SciScriptPatcherRuntimeEntry *runtimeEntry, const SciSpan<const byte> &scriptData) {
-	return findSignature(runtimeEntry->magicDWord, runtimeEntry->magicOffset, patchEntry->signatureData, patchEntry->description, scriptData);
-}
-
 // Attention: Magic DWord is returned using platform specific byte order. This is done on purpose for performance.
 void ScriptPatcher::calculateMagicDWordAndVerify(const char *signatureDescription, const uint16 *signatureData, bool magicDWordIncluded, uint32 &calculatedMagicDWord, int &calculatedMagicDWordOffset) {
 	Selector curSelector = -1;
@@ -17039,6 +17035,107 @@ void ScriptPatcher::initSignature(const SciScriptPatcherEntry *patchTable) {
 
 		curEntry++; curRuntimeEntry++;
 	}
+
+	buildScriptIndex(patchTable);
+}
+
+// This method groups the entries of the patch table by script number, so that
+//  loading a script only has to look at the entries for that script, and
+//  collects their magic DWORDs, so that all of them can be searched for at once
+void ScriptPatcher::buildScriptIndex(const SciScriptPatcherEntry *patchTable) {
+	_scriptIndex.clear();
+	_resultCache.clear();
+
+	const SciScriptPatcherEntry *curEntry = patchTable;
+	const SciScriptPatcherRuntimeEntry *curRuntimeEntry = _runtimeTable;
+	uint16 entryIndex = 0;
+
+	while (curEntry->signatureData) {
+		if (!_scriptIndex.contains(curEntry->scriptNr)) {
+			ScriptIndex &newIndex = _scriptIndex[curEntry->scriptNr];
+			memset(newIndex.firstBytes, 0, sizeof(newIndex.firstBytes));
+		}
+		ScriptIndex &index = _scriptIndex[curEntry->scriptNr];
+
+		const uint32 magicDWord = curRuntimeEntry->magicDWord;
+		uint16 magicIndex = 0;
+		while (magicIndex < index.magicDWords.size() && index.magicDWords[magicIndex] != magicDWord) {
+			magicIndex++;
+		}
+		if (magicIndex == index.magicDWords.size()) {
+			index.magicDWords.push_back(magicDWord);
+
+			const byte firstByte = *(const byte *)&magicDWord;
+			index.firstBytes[firstByte >> 5] |= 1 << (firstByte & 31);
+		}
+
+		index.entries.push_back(entryIndex);
+		index.entryMagicDWords.push_back(magicIndex);
+
+		curEntry++; curRuntimeEntry++; entryIndex++;
+	}
+}
+
+void ScriptPatcher::findMagicDWords(const ScriptIndex &index, const SciSpan<const byte> &scriptData, MagicDWordHits &hits) const {
+	hits.clear();
+	hits.resize(index.magicDWords.size());
+
+	if (scriptData.size() < 4) // we need to find a DWORD, so less than 4 bytes is not okay
+		return;
+
+	const uint32 searchLimit = scriptData.size() - 3;
+	const byte *data = scriptData.getUnsafeDataAt(0, scriptData.size());
+	const uint numMagicDWords = index.magicDWords.size();
+
+	for (uint32 offset = 0; offset < searchLimit; ++offset) {
+		const byte curByte = data[offset];
+		if (!(index.firstBytes[curByte >> 5] & (1 << (curByte & 31))))
+			continue;
+
+		// magicDWord is in platform-specific BE/LE form, just like in findSignature()
+		const uint32 curDWord = READ_UINT32(data + offset);
+		for (uint magicIndex = 0; magicIndex < numMagicDWords; ++magicIndex) {
+			if (index.magicDWords[magicIndex] == curDWord)
+				hits[magicIndex].push_back(offset);
+		}
+	}
+}
+
+bool ScriptPatcher::applyCachedResult(const SciScriptPatcherEntry *patchTable, const CachedResult &result, SciSpan<byte> scriptData) {
+	if (result.patches.empty())
+		return true;
+
+	// Patches may depend on earlier ones, so the signatures can only be
+	//  checked while applying. Keep the unpatched script around, so that
+	//  a mismatch doesn't leave it partially patched.
+	byte *data = scriptData.getUnsafeDataAt(0, scriptData.size());
+	const Common::Array<byte> original(data, scriptData.size());
+
+	for (uint i = 0; i < result.patches.size(); ++i) {
+		const AppliedPatch &patch = result.patches[i];
+		const SciScriptPatcherEntry *curEntry = patchTable + patch.entryIndex;
+
+		// Only a checksum of the script is compared, so make sure that the
+		//  signature really is where it was the last time
+		if (!verifySignature(patch.offset, curEntry->signatureData, curEntry->description, scriptData)) {
+			memcpy(data, original.begin(), original.size());
+			return false;
+		}
+
+		debugC(kDebugLevelScriptPatcher, "Script-Patcher: '%s' on script %d offset %d (cached)", curEntry->description, curEntry->scriptNr, patch.offset);
+		applyPatch(curEntry, scriptData, patch.offset);
+	}
+	return true;
+}
+
+static uint32 calculateScriptChecksum(const SciSpan<const byte> &scriptData) {
+	// FNV-1a
+	const byte *data = scriptData.getUnsafeDataAt(0, scriptData.size());
+	uint32 checksum = 2166136261U;
+	for (uint32 i = 0; i < scriptData.size(); ++i) {
+		checksum = (checksum ^ data[i]) * 16777619U;
+	}
+	return checksum;
 }
 
 // This method enables certain patches
@@ -17302,25 +17399,71 @@ void ScriptPatcher::processScript(uint16 scriptNr, SciSpan<byte> scriptData) {
 			}
 		}
 
-		curEntry = signatureTable;
-		curRuntimeEntry = _runtimeTable;
-
-		while (curEntry->signatureData) {
-			if ((scriptNr == curEntry->scriptNr) && (curRuntimeEntry->active)) {
-				int32 foundOffset = 0;
-				int16 applyCount = curEntry->applyCount;
-				do {
-					foundOffset = findSignature(curEntry, curRuntimeEntry, scriptData);
-					if (foundOffset != -1) {
-						// found, so apply the patch
-						debugC(kDebugLevelScriptPatcher, "Script-Patcher: '%s' on script %d offset %d", curEntry->description, scriptNr, foundOffset);
-						applyPatch(curEntry, scriptData, foundOffset);
+		ScriptIndexMap::const_iterator indexIt = _scriptIndex.find(scriptNr);
+		if (indexIt == _scriptIndex.end())
+			return;
+		const ScriptIndex &index = indexIt->_value;
+
+		// Scripts get loaded again every time they are needed after having
+		//  been disposed, so the patches applied to them are remembered and
+		//  simply reapplied if the script data is unchanged
+		const uint32 checksum = calculateScriptChecksum(scriptData);
+		ResultCache::const_iterator cacheIt = _resultCache.find(scriptNr);
+		if (cacheIt != _resultCache.end() && cacheIt->_value.size == scriptData.size() && cacheIt->_value.checksum == checksum) {
+			if (applyCachedResult(signatureTable, cacheIt->_value, scriptData))
+				return;
+
+			// Should never happen, except for a checksum collision. The
+			//  script data has been restored, so it is safe to search again.
+			warning("Script-Patcher: cached patches for script %d do not match, searching again", scriptNr);
+		}
+
+		CachedResult result;
+		result.size = scriptData.size();
+		result.checksum = checksum;
+
+		MagicDWordHits hits;
+		findMagicDWords(index, scriptData, hits);
+
+		for (uint i = 0; i < index.entries.size(); ++i) {
+			const uint16 entryIndex = index.entries[i];
+			curEntry = signatureTable + entryIndex;
+			curRuntimeEntry = _runtimeTable + entryIndex;
+			if (!curRuntimeEntry->active)
+				continue;
+
+			int32 foundOffset = 0;
+			int16 applyCount = curEntry->applyCount;
+			do {
+				// Same as findSignature(), but using the magic DWORD offsets
+				//  found beforehand
+				const Common::Array<uint32> &magicOffsets = hits[index.entryMagicDWords[i]];
+				foundOffset = -1;
+				for (uint j = 0; j < magicOffsets.size(); ++j) {
+					const uint32 offset = magicOffsets[j] + curRuntimeEntry->magicOffset;
+					if (verifySignature(offset, curEntry->signatureData, curEntry->description, scriptData)) {
+						foundOffset = offset;
+						break;
 					}
-					applyCount--;
-				} while ((foundOffset != -1) && (applyCount));
-			}
-			curEntry++; curRuntimeEntry++;
+				}
+
+				if (foundOffset != -1) {
+					// found, so apply the patch
+					debugC(kDebugLevelScriptPatcher, "Script-Patcher: '%s' on script %d offset %d", curEntry->description, scriptNr, foundOffset);
+					applyPatch(curEntry, scriptData, foundOffset);
+
+					AppliedPatch appliedPatch = { entryIndex, foundOffset };
+					result.patches.push_back(appliedPatch);
+
+					// The patch changed the script data, which may add or
+					//  remove occurrences of magic DWORDs
+					findMagicDWords(index, scriptData, hits);
+				}
+				applyCount--;
+			} while ((foundOffset != -1) && (applyCount));
 		}
+
+		_resultCache.setVal(scriptNr, result);
 	}
 }
 
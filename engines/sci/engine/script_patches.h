@@ -23,6 +23,9 @@
 #ifndef SCI_ENGINE_SCRIPT_PATCHES_H
 #define SCI_ENGINE_SCRIPT_PATCHES_H
 
+#include "common/array.h"
+#include "common/hashmap.h"
+
 #include "sci/sci.h"
 
 namespace Sci {
@@ -106,23 +109,87 @@ public:
 	// returns -1 in case it was not found or an offset to the matching data
 	int32 findSignature(uint32 magicDWord, int magicOffset, const uint16 *signatureData, const char *patchDescription, const SciSpan<const byte> &scriptData);
 
+	// Forgets the remembered patch results of previously processed scripts
+	void clearResultCache() { _resultCache.clear(); }
+
 private:
+	/**
+	 * The patch table entries of one script, compiled when the patch table is
+	 * initialized, so that all of their magic DWords can be searched for in a
+	 * single pass over the script data.
+	 */
+	struct ScriptIndex {
+		// Indexes of the patch table entries for this script, in table order
+		Common::Array<uint16> entries;
+
+		// Index into magicDWords for every entry in entries
+		Common::Array<uint16> entryMagicDWords;
+
+		// The distinct magic DWords of all entries, in platform byte order
+		Common::Array<uint32> magicDWords;
+
+		// Bit set of the first bytes (in memory) of all magic DWords, used to
+		// reject most script offsets with a single lookup
+		uint32 firstBytes[256 / 32];
+	};
+
+	typedef Common::HashMap<uint16, ScriptIndex> ScriptIndexMap;
+
+	/**
+	 * Offsets (in ascending order) at which each magic DWord of a ScriptIndex
+	 * occurs in the script data.
+	 */
+	typedef Common::Array<Common::Array<uint32> > MagicDWordHits;
+
+	/**
+	 * A patch that was applied to a script, so that the same patches can be
+	 * reapplied without searching when the same script is loaded again.
+	 */
+	struct AppliedPatch {
+		uint16 entryIndex;
+		int32 offset;
+	};
+
+	/**
+	 * The patches that were applied the last time a script was processed,
+	 * along with the size and checksum of the unpatched script data.
+	 */
+	struct CachedResult {
+		uint32 size;
+		uint32 checksum;
+		Common::Array<AppliedPatch> patches;
+	};
+
+	typedef Common::HashMap<uint16, CachedResult> ResultCache;
+
+
 	// Initializes a patch table and creates run time information for it (for enabling/disabling), also calculates magic DWORD)
 	void initSignature(const SciScriptPatcherEntry *patchTable);
 
 	// Enables a patch inside the patch table (used for optional patches like CD+Text support for KQ6 & LB2)
 	void enablePatch(const SciScriptPatcherEntry *patchTable, const char *searchDescription);
 
-	// Searches for a given signature entry inside script data
-	// returns -1 in case it was not found or an offset to the matching data
-	int32 findSignature(const SciScriptPatcherEntry *patchEntry, const SciScriptPatcherRuntimeEntry *runtimeEntry, const SciSpan<const byte> &scriptData);
-
 	// Applies a patch to a given script + offset (overwrites parts)
 	void applyPatch(const SciScriptPatcherEntry *patchEntry, SciSpan<byte> scriptData, int32 signatureOffset);
 
+	// Builds the per-script indexes for the initialized patch table
+	void buildScriptIndex(const SciScriptPatcherEntry *patchTable);
+
+	// Finds all occurrences of the magic DWords of a script index in one pass
+	void findMagicDWords(const ScriptIndex &index, const SciSpan<const byte> &scriptData, MagicDWordHits &hits) const;
+
+	// Reapplies cached patches, returns false if the cached result did not match
+	bool applyCachedResult(const SciScriptPatcherEntry *patchTable, const CachedResult &result, SciSpan<byte> scriptData);
+
 	Selector *_selectorIdTable;
 	SciScriptPatcherRuntimeEntry *_runtimeTable;
 	bool _isMacSci11;
+
+	// Patch table entries, grouped by script number
+	ScriptIndexMap _scriptIndex;
+
+	// Patches applied per script number, keyed by the checksum of the script
+	ResultCache _resultCache;
 };
 
 } // End of namespace Sci
@@ -91,12 +91,19 @@ void CelObj::init() {
 	_drawBlackLines = false;
 	_nextCacheId = 1;
 	_scaler.reset(new CelScaler());
-	_cache.reset(new CelCache(100));
+
+	int cacheSize = kCelCacheSize;
+	if (ConfMan.hasKey("sci_cel_cache_size")) {
+		cacheSize = MAX(1, ConfMan.getInt("sci_cel_cache_size"));
+	}
+	_cache.reset(new CelCache(cacheSize));
+	_cacheIndex.reset(new CelCacheIndex());
 }
 
 void CelObj::deinit() {
 	_scaler.reset();
 	_cache.reset();
+	_cacheIndex.reset();
 }
 
 #pragma mark -
@@ -147,6 +154,25 @@ struct SCALER_NoScale {
 			return *_row++;
 		}
 	}
+
+	/**
+	 * Returns a pointer to the next `length` source pixels and advances past
+	 * them. When flipped, pixels must be read backwards from the returned
+	 * pointer.
+	 */
+	inline const byte *readSpan(const int16 length) {
+		const byte *span = _row;
+
+		if (FLIP) {
+			_row -= length;
+			assert(_row >= _rowEdge);
+		} else {
+			_row += length;
+			assert(_row <= _rowEdge);
+		}
+
+		return span;
+	}
 };
 
 template<bool FLIP, typename READER>
@@ -667,8 +693,20 @@ void CelObj::submitPalette() const {
 int CelObj::_nextCacheId = 1;
 Common::ScopedPtr<CelCache> CelObj::_cache;
 
+Common::ScopedPtr<CelCacheIndex> CelObj::_cacheIndex;
+
 int CelObj::searchCache(const CelInfo32 &celInfo, int *const nextInsertIndex) const {
 	*nextInsertIndex = -1;
+
+	const CelCacheIndex::const_iterator cachedIndex = _cacheIndex->find(celInfo);
+	if (cachedIndex != _cacheIndex->end()) {
+		CelCacheEntry &entry = (*_cache)[cachedIndex->_value];
+		entry.id = ++_nextCacheId;
+		return cachedIndex->_value;
+	}
+
+	// Only misses need to find a slot, and they are followed by loading the
+	// cel from its resource anyway, so a scan of the cache is fine here
 	int oldestId = _nextCacheId + 1;
 	int oldestIndex = 0;
 
@@ -679,9 +717,6 @@ int CelObj::searchCache(const CelInfo32 &celInfo, int *const nextInsertIndex) co
 			if (*nextInsertIndex == -1) {
 				*nextInsertIndex = i;
 			}
-		} else if (entry.celObj->_info == celInfo) {
-			entry.id = ++_nextCacheId;
-			return i;
 		} else if (oldestId > entry.id) {
 			oldestId = entry.id;
 			oldestIndex = i;
@@ -701,13 +736,103 @@ void CelObj::putCopyInCache(const int cacheIndex) const {
 	}
 
 	CelCacheEntry &entry = (*_cache)[cacheIndex];
+	if (entry.celObj != nullptr) {
+		_cacheIndex->erase(entry.celObj->_info);
+	}
 	entry.celObj.reset(duplicate());
 	entry.id = ++_nextCacheId;
+	(*_cacheIndex)[_info] = cacheIndex;
 }
 
 #pragma mark -
 #pragma mark CelObj - Drawing
 
+/**
+ * Draws a single row of pixels from a scaler through a mapper. This generic
+ * version reads and maps one pixel at a time; unscaled rows with no remapping
+ * are handled by the specialisations below, which work on whole spans of
+ * source pixels.
+ */
+template<typename MAPPER, typename SCALER>
+struct ROW_RENDERER {
+	static inline void draw(const MAPPER &mapper, SCALER &scaler, byte *target, const int16 width, const uint8 skipColor) {
+		for (int16 x = 0; x < width; ++x) {
+			mapper.draw(target++, scaler.read(), skipColor);
+		}
+	}
+};
+
+template<typename READER>
+struct ROW_RENDERER<MAPPER_NoMDNoSkip, SCALER_NoScale<false, READER> > {
+	static inline void draw(const MAPPER_NoMDNoSkip &, SCALER_NoScale<false, READER> &scaler, byte *target, const int16 width, const uint8) {
+		memcpy(target, scaler.readSpan(width), width);
+	}
+};
+
+template<typename READER>
+struct ROW_RENDERER<MAPPER_NoMDNoSkip, SCALER_NoScale<true, READER> > {
+	static inline void draw(const MAPPER_NoMDNoSkip &, SCALER_NoScale<true, READER> &scaler, byte *target, const int16 width, const uint8) {
+		const byte *source = scaler.readSpan(width);
+		for (int16 x = 0; x < width; ++x) {
+			target[x] = *(source - x);
+		}
+	}
+};
+
+template<typename READER>
+struct ROW_RENDERER<MAPPER_NoMD, SCALER_NoScale<false, READER> > {
+	static inline void draw(const MAPPER_NoMD &, SCALER_NoScale<false, READER> &scaler, byte *target, int16 width, const uint8 skipColor) {
+		const byte *source = scaler.readSpan(width);
+
+		// Transparent cels usually consist of long runs that are either fully
+		// opaque or fully transparent, so test four pixels at a time against
+		// the skip color and only fall back to per-pixel checks for groups
+		// that contain both
+		const uint32 skipPattern = skipColor * 0x01010101;
+		while (width >= 4) {
+			const uint32 pixels = READ_UINT32(source);
+			const uint32 difference = pixels ^ skipPattern;
+			if (difference == 0) {
+				// All four pixels are transparent
+			} else if (((difference - 0x01010101) & ~difference & 0x80808080) == 0) {
+				// No pixels are transparent
+				WRITE_UINT32(target, pixels);
+			} else {
+				for (int i = 0; i < 4; ++i) {
+					if (source[i] != skipColor) {
+						target[i] = source[i];
+					}
+				}
+			}
+
+			source += 4;
+			target += 4;
+			width -= 4;
+		}
+
+		while (width--) {
+			if (*source != skipColor) {
+				*target = *source;
+			}
+			++source;
+			++target;
+		}
+	}
+};
+
+template<typename READER>
+struct ROW_RENDERER<MAPPER_NoMD, SCALER_NoScale<true, READER> > {
+	static inline void draw(const MAPPER_NoMD &, SCALER_NoScale<true, READER> &scaler, byte *target, const int16 width, const uint8 skipColor) {
+		const byte *source = scaler.readSpan(width);
+		for (int16 x = 0; x < width; ++x) {
+			const byte pixel = *(source - x);
+			if (pixel != skipColor) {
+				target[x] = pixel;
+			}
+		}
+	}
+};
+
 template<typename MAPPER, typename SCALER, bool DRAW_BLACK_LINES>
 struct RENDERER {
 	MAPPER &_mapper;
@@ -733,12 +858,8 @@ struct RENDERER {
 			}
 
 			_scaler.setTarget(targetRect.left, targetRect.top + y);
-
-			for (int16 x = 0; x < targetWidth; ++x) {
-				_mapper.draw(targetPixel++, _scaler.read(), _skipColor);
-			}
-
-			targetPixel += skipStride;
+			ROW_RENDERER<MAPPER, SCALER>::draw(_mapper, _scaler, targetPixel, targetWidth, _skipColor);
+			targetPixel += targetWidth + skipStride;
 		}
 	}
 };
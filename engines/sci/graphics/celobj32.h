@@ -23,6 +23,7 @@
 #ifndef SCI_GRAPHICS_CELOBJ32_H
 #define SCI_GRAPHICS_CELOBJ32_H
 
+#include "common/hashmap.h"
 #include "common/rational.h"
 #include "common/rect.h"
 #include "sci/resource.h"
@@ -105,7 +106,7 @@ struct CelInfo32 {
 
 	// This is the equivalence criteria used by CelObj::searchCache in at least
 	// SSCI SQ6. Notably, it does not check the color field.
-	inline bool operator==(const CelInfo32 &other) {
+	inline bool operator==(const CelInfo32 &other) const {
 		return (
 			type == other.type &&
 			resourceId == other.resourceId &&
@@ -115,7 +116,7 @@ struct CelInfo32 {
 		);
 	}
 
-	inline bool operator!=(const CelInfo32 &other) {
+	inline bool operator!=(const CelInfo32 &other) const {
 		return !(*this == other);
 	}
 
@@ -138,6 +139,16 @@ struct CelInfo32 {
 	}
 };
 
+enum {
+	/**
+	 * The default number of entries in the cel cache. SSCI used 100 entries;
+	 * hi-res games with many animated screen items cycle through more cels
+	 * than that. The size can be overridden with the `sci_cel_cache_size`
+	 * configuration key.
+	 */
+	kCelCacheSize = 250
+};
+
 class CelObj;
 struct CelCacheEntry {
 	/**
@@ -151,6 +162,22 @@ struct CelCacheEntry {
 
 typedef Common::Array<CelCacheEntry> CelCache;
 
+/**
+ * Hashes the same fields of a CelInfo32 that are compared by its equality
+ * operator.
+ */
+struct CelInfo32Hash {
+	inline uint operator()(const CelInfo32 &info) const {
+		return (info.type << 28) ^ (info.resourceId << 12) ^ (info.loopNo << 6) ^ info.celNo ^
+			(info.bitmap.getSegment() << 16) ^ info.bitmap.getOffset();
+	}
+};
+
+/**
+ * Maps the CelInfo32 of each cached CelObj to its index in the CelCache.
+ */
+typedef Common::HashMap<CelInfo32, int, CelInfo32Hash> CelCacheIndex;
+
 #pragma mark -
 #pragma mark CelScaler
 
@@ -459,6 +486,12 @@ protected:
 	 */
 	static Common::ScopedPtr<CelCache> _cache;
 
+	/**
+	 * An index of the occupied entries in `_cache`, used to look up cached cels
+	 * without scanning the whole cache.
+	 */
+	static Common::ScopedPtr<CelCacheIndex> _cacheIndex;
+
 	/**
 	 * Searches the cel cache for a CelObj matching the provided CelInfo32. If
 	 * not found, -1 is returned. `nextInsertIndex` will receive the index of
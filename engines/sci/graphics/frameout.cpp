@@ -691,6 +691,8 @@ int splitRectsForRender(Common::Rect &middleRect, const Common::Rect &showRect,
 
 // The third rectangle parameter is only ever passed by VMD code
 void GfxFrameout::calcLists(ScreenItemListList &drawLists, EraseListList &eraseLists, const Common::Rect &eraseRect) {
+	_frameStats = FrameStats();
+
 	RectList eraseList;
 	Common::Rect outRects[4];
 	int deletedPlaneCount = 0;
@@ -938,8 +940,10 @@ void GfxFrameout::drawEraseList(const RectList &eraseList, const Plane &plane) {
 
 	const RectList::size_type eraseListSize = eraseList.size();
 	for (RectList::size_type i = 0; i < eraseListSize; ++i) {
-		mergeToShowList(*eraseList[i], _showList, _overdrawThreshold);
-		_currentBuffer.fillRect(*eraseList[i], plane._back);
+		const Common::Rect &rect = *eraseList[i];
+		mergeToShowList(rect, _showList, _overdrawThreshold);
+		_currentBuffer.fillRect(rect, plane._back);
+		_frameStats.erasedPixels += rect.width() * rect.height();
 	}
 }
 
@@ -951,7 +955,9 @@ void GfxFrameout::drawScreenItemList(const DrawList &screenItemList) {
 		const ScreenItem &screenItem = *drawItem.screenItem;
 		CelObj &celObj = *screenItem._celObj;
 		celObj.draw(_currentBuffer, screenItem, drawItem.rect, screenItem._mirrorX ^ celObj._mirrorX);
+		_frameStats.drawnPixels += drawItem.rect.width() * drawItem.rect.height();
 	}
+	_frameStats.drawItems += drawListSize;
 }
 
 void GfxFrameout::mergeToShowList(const Common::Rect &drawRect, RectList &showList, const int overdrawThreshold) {
@@ -1063,6 +1069,8 @@ void GfxFrameout::showBits() {
 #endif
 			g_system->copyRectToScreen(sourceBuffer, _currentBuffer.w, rounded.left, rounded.top, rounded.width(), rounded.height());
 		}
+
+		_frameStats.shownPixels += rounded.width() * rounded.height();
 	}
 
 	_cursor->donePainting();
@@ -1433,4 +1441,13 @@ void GfxFrameout::printVisiblePlaneItemList(Console *con, const reg_t planeObjec
 	printPlaneItemListInternal(con, p->_screenItemList);
 }
 
+void GfxFrameout::printFrameStats(Console *con) const {
+	const uint32 screenPixels = _currentBuffer.w * _currentBuffer.h;
+	con->debugPrintf("Draw items: %u\n", _frameStats.drawItems);
+	con->debugPrintf("Drawn pixels: %u (%u%% of screen)\n", _frameStats.drawnPixels, _frameStats.drawnPixels * 100 / screenPixels);
+	con->debugPrintf("Erased pixels: %u (%u%% of screen)\n", _frameStats.erasedPixels, _frameStats.erasedPixels * 100 / screenPixels);
+	con->debugPrintf("Shown pixels: %u (%u%% of screen)\n", _frameStats.shownPixels, _frameStats.shownPixels * 100 / screenPixels);
+	con->debugPrintf("Hidden rects culled: %u\n", _frameStats.culledRects);
+}
+
 } // End of namespace Sci
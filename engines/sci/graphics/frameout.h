@@ -432,6 +432,59 @@ public:
 	void printPlaneItemList(Console *con, const reg_t planeObject) const;
 	void printVisiblePlaneItemList(Console *con, const reg_t planeObject) const;
 	void printPlaneItemListInternal(Console *con, const ScreenItemList &screenItemList) const;
+	void printFrameStats(Console *con) const;
+
+	/**
+	 * Records draw and erase rects that were discarded because they were
+	 * completely hidden behind other planes.
+	 */
+	inline void addCulledRects(const uint count) {
+		_frameStats.culledRects += count;
+	}
+
+private:
+	/**
+	 * Rendering statistics for a single frame.
+	 */
+	struct FrameStats {
+		/**
+		 * The number of pixels drawn from screen items.
+		 */
+		uint32 drawnPixels;
+
+		/**
+		 * The number of pixels filled from plane erase lists.
+		 */
+		uint32 erasedPixels;
+
+		/**
+		 * The number of pixels sent to the backend.
+		 */
+		uint32 shownPixels;
+
+		/**
+		 * The number of draw list entries that were rendered.
+		 */
+		uint drawItems;
+
+		/**
+		 * The number of draw and erase rects that were skipped because they
+		 * were completely hidden behind other planes.
+		 */
+		uint culledRects;
+
+		FrameStats() :
+			drawnPixels(0),
+			erasedPixels(0),
+			shownPixels(0),
+			drawItems(0),
+			culledRects(0) {}
+	};
+
+	/**
+	 * Rendering statistics for the most recent call to `frameOut`.
+	 */
+	FrameStats _frameStats;
 };
 
 } // End of namespace Sci
@@ -42,6 +42,71 @@ void DrawList::add(ScreenItem *screenItem, const Common::Rect &rect) {
 	DrawListBase::add(drawItem);
 }
 
+#pragma mark -
+#pragma mark OcclusionGrid
+OcclusionGrid::OcclusionGrid(const Common::Rect &bounds) :
+	_bounds(bounds),
+	_tilesWide(0),
+	_tilesHigh(0),
+	_numHiddenTiles(0) {
+
+	if (!_bounds.isEmpty()) {
+		_tilesWide = (_bounds.width() + kTileSize - 1) / kTileSize;
+		_tilesHigh = (_bounds.height() + kTileSize - 1) / kTileSize;
+		_hidden.resize(_tilesWide * _tilesHigh);
+	}
+}
+
+Common::Rect OcclusionGrid::getTileRect(const int16 x, const int16 y) const {
+	Common::Rect tileRect(kTileSize, kTileSize);
+	tileRect.moveTo(_bounds.left + x * kTileSize, _bounds.top + y * kTileSize);
+	tileRect.clip(_bounds);
+	return tileRect;
+}
+
+void OcclusionGrid::addOccluder(const Common::Rect &rect) {
+	if (!rect.intersects(_bounds)) {
+		return;
+	}
+
+	const Common::Rect r = rect.findIntersectingRect(_bounds);
+	const int16 minX = (r.left - _bounds.left) / kTileSize;
+	const int16 minY = (r.top - _bounds.top) / kTileSize;
+	const int16 maxX = (r.right - 1 - _bounds.left) / kTileSize;
+	const int16 maxY = (r.bottom - 1 - _bounds.top) / kTileSize;
+
+	for (int16 y = minY; y <= maxY; ++y) {
+		for (int16 x = minX; x <= maxX; ++x) {
+			bool &hidden = _hidden[y * _tilesWide + x];
+			if (!hidden && rect.contains(getTileRect(x, y))) {
+				hidden = true;
+				++_numHiddenTiles;
+			}
+		}
+	}
+}
+
+bool OcclusionGrid::isHidden(const Common::Rect &rect) const {
+	if (rect.isEmpty() || !_bounds.contains(rect)) {
+		return false;
+	}
+
+	const int16 minX = (rect.left - _bounds.left) / kTileSize;
+	const int16 minY = (rect.top - _bounds.top) / kTileSize;
+	const int16 maxX = (rect.right - 1 - _bounds.left) / kTileSize;
+	const int16 maxY = (rect.bottom - 1 - _bounds.top) / kTileSize;
+
+	for (int16 y = minY; y <= maxY; ++y) {
+		for (int16 x = minX; x <= maxX; ++x) {
+			if (!_hidden[y * _tilesWide + x]) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
 #pragma mark -
 #pragma mark Plane
 uint16 Plane::_nextObjectId; // Will be initialized in Plane::init()
@@ -262,6 +327,45 @@ void Plane::deleteAllPics() {
 #pragma mark -
 #pragma mark Plane - Rendering
 
+void Plane::cullHiddenRects(DrawList &drawList, RectList &eraseList, const PlaneList &planeList) const {
+	const int nextPlaneIndex = planeList.findIndexByObject(_object) + 1;
+	const PlaneList::size_type planeCount = planeList.size();
+
+	OcclusionGrid occlusionGrid(Common::Rect(g_sci->_gfxFrameout->getScreenWidth(), g_sci->_gfxFrameout->getScreenHeight()));
+	for (PlaneList::size_type j = nextPlaneIndex; j < planeCount; ++j) {
+		if (
+			planeList[j]->_type != kPlaneTypeTransparent &&
+			planeList[j]->_type != kPlaneTypeTransparentPicture
+		) {
+			occlusionGrid.addOccluder(planeList[j]->_screenRect);
+		}
+	}
+
+	if (!occlusionGrid.hasHiddenTiles()) {
+		return;
+	}
+
+	uint numCulled = 0;
+
+	for (DrawList::size_type i = 0; i < drawList.size(); ++i) {
+		if (drawList[i] != nullptr && occlusionGrid.isHidden(drawList[i]->rect)) {
+			drawList.erase_at(i);
+			++numCulled;
+		}
+	}
+	drawList.pack();
+
+	for (RectList::size_type i = 0; i < eraseList.size(); ++i) {
+		if (eraseList[i] != nullptr && occlusionGrid.isHidden(*eraseList[i])) {
+			eraseList.erase_at(i);
+			++numCulled;
+		}
+	}
+	eraseList.pack();
+
+	g_sci->_gfxFrameout->addCulledRects(numCulled);
+}
+
 void Plane::breakDrawListByPlanes(DrawList &drawList, const PlaneList &planeList) const {
 	const int nextPlaneIndex = planeList.findIndexByObject(_object) + 1;
 	const PlaneList::size_type planeCount = planeList.size();
@@ -423,6 +527,7 @@ void Plane::calcLists(Plane &visiblePlane, const PlaneList &planeList, DrawList
 	}
 
 	// Remove parts of eraselist/drawlist that are covered by other planes
+	cullHiddenRects(drawList, eraseList, planeList);
 	breakEraseListByPlanes(eraseList, planeList);
 	breakDrawListByPlanes(drawList, planeList);
 
@@ -742,6 +847,7 @@ void Plane::redrawAll(Plane *visiblePlane, const PlaneList &planeList, DrawList
 	if (!_screenRect.isEmpty() && _type != kPlaneTypePicture && _type != kPlaneTypeOpaque) {
 		eraseList.add(_screenRect);
 	}
+	cullHiddenRects(drawList, eraseList, planeList);
 	breakEraseListByPlanes(eraseList, planeList);
 	breakDrawListByPlanes(drawList, planeList);
 	--_redrawAllCount;
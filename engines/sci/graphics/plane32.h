@@ -94,6 +94,70 @@ public:
 
 class PlaneList;
 
+#pragma mark -
+#pragma mark OcclusionGrid
+
+/**
+ * A coarse grid of tiles covering the area of the screen which is hidden behind
+ * higher-priority opaque planes. Any rect which only touches hidden tiles would
+ * be split away to nothing by `Plane::breakDrawListByPlanes` and
+ * `Plane::breakEraseListByPlanes`, so it can be thrown away without splitting
+ * it against every plane above.
+ */
+class OcclusionGrid {
+public:
+	enum {
+		kTileSize = 16
+	};
+
+	/**
+	 * Creates an empty grid. The grid never reports rects outside of `bounds`
+	 * as hidden.
+	 */
+	OcclusionGrid(const Common::Rect &bounds);
+
+	/**
+	 * Marks all tiles that are entirely inside of `rect` as hidden.
+	 */
+	void addOccluder(const Common::Rect &rect);
+
+	/**
+	 * Returns true if `rect` is entirely covered by hidden tiles.
+	 */
+	bool isHidden(const Common::Rect &rect) const;
+
+	/**
+	 * Returns true if at least one tile in the grid is hidden.
+	 */
+	inline bool hasHiddenTiles() const { return _numHiddenTiles > 0; }
+
+private:
+	/**
+	 * The screen area covered by the grid.
+	 */
+	Common::Rect _bounds;
+
+	/**
+	 * The number of tiles in each row and column of the grid.
+	 */
+	int16 _tilesWide, _tilesHigh;
+
+	/**
+	 * The hidden state of each tile, in row-major order.
+	 */
+	Common::Array<bool> _hidden;
+
+	/**
+	 * The number of tiles which are currently marked as hidden.
+	 */
+	uint _numHiddenTiles;
+
+	/**
+	 * Gets the screen area of the given tile, clipped to the grid bounds.
+	 */
+	Common::Rect getTileRect(const int16 x, const int16 y) const;
+};
+
 #pragma mark -
 #pragma mark Plane
 
@@ -356,6 +420,15 @@ public:
 #pragma mark -
 #pragma mark Plane - Rendering
 private:
+	/**
+	 * Removes all rects from the given draw and erase lists which are
+	 * completely hidden behind higher-priority, non-transparent planes. This
+	 * gives the same result as letting `breakDrawListByPlanes` and
+	 * `breakEraseListByPlanes` split those rects away, but without the cost of
+	 * splitting.
+	 */
+	void cullHiddenRects(DrawList &drawList, RectList &eraseList, const PlaneList &planeList) const;
+
 	/**
 	 * Splits all rects in the given draw list at the edges of all
 	 * higher-priority, non-transparent, intersecting planes.
@@ -174,7 +174,9 @@ Audio32::Audio32(ResourceManager *resMan) :
 	_useModifiedAttenuation(g_sci->_features->usesModifiedAudioAttenuation()),
 
 	_monitoredChannelIndex(-1),
-	_numMonitoredSamples(0) {
+	_numMonitoredSamples(0),
+
+	_mixStats() {
 	// In games where scripts premultiply master audio volumes into the volumes
 	// of the individual audio channels sent to the mixer, Audio32 needs to use
 	// the kPlainSoundType so that the master SFX volume is not applied twice.
@@ -204,17 +206,18 @@ int Audio32::writeAudioInternal(Audio::AudioStream &sourceStream, Audio::RateCon
 
 int16 Audio32::getNumChannelsToMix() const {
 	Common::StackLock lock(_mutex);
+	const uint32 now = g_sci->getTickCount();
 	int16 numChannels = 0;
 	for (int16 channelIndex = 0; channelIndex < _numActiveChannels; ++channelIndex) {
 		const AudioChannel &channel = getChannel(channelIndex);
-		if (channelShouldMix(channel)) {
+		if (channelShouldMix(channel, now)) {
 			++numChannels;
 		}
 	}
 	return numChannels;
 }
 
-bool Audio32::channelShouldMix(const AudioChannel &channel) const {
+bool Audio32::channelShouldMix(const AudioChannel &channel, const uint32 now) const {
 	if (channel.pausedAtTick ||
 		(channel.robot && (_robotAudioPaused || channel.stream->endOfStream()))) {
 
@@ -222,7 +225,7 @@ bool Audio32::channelShouldMix(const AudioChannel &channel) const {
 	}
 
 	if (channel.fadeStartTick) {
-		const uint32 fadeElapsed = g_sci->getTickCount() - channel.fadeStartTick;
+		const uint32 fadeElapsed = now - channel.fadeStartTick;
 		if (fadeElapsed > channel.fadeDuration && channel.stopChannelOnFade) {
 			return false;
 		}
@@ -260,6 +263,8 @@ int Audio32::readBuffer(Audio::st_sample_t *const buffer, const int numSamples)
 		return 0;
 	}
 
+	const uint32 mixStartTime = g_system->getMillis();
+
 	// ResourceManager is not thread-safe so we need to avoid calling into it
 	// from the audio thread, but at the same time we need to be able to clear
 	// out any finished channels on a regular basis
@@ -377,7 +382,7 @@ int Audio32::readBuffer(Audio::st_sample_t *const buffer, const int numSamples)
 			if (numSamples > (int)_monitoredBuffer.size()) {
 				_monitoredBuffer.resize(numSamples);
 			}
-			memset(_monitoredBuffer.data(), 0, _monitoredBuffer.size() * sizeof(Audio::st_sample_t));
+			memset(_monitoredBuffer.data(), 0, numSamples * sizeof(Audio::st_sample_t));
 			_numMonitoredSamples = writeAudioInternal(*channel.stream, *channel.converter, _monitoredBuffer.data(), numSamples, leftVolume, rightVolume);
 
 			Audio::st_sample_t *sourceBuffer = _monitoredBuffer.data();
@@ -410,6 +415,10 @@ int Audio32::readBuffer(Audio::st_sample_t *const buffer, const int numSamples)
 
 	_inAudioThread = false;
 
+	++_mixStats.numBuffers;
+	_mixStats.numSamples += maxSamplesWritten;
+	_mixStats.mixTime += g_system->getMillis() - mixStartTime;
+
 	return maxSamplesWritten;
 }
 
@@ -1351,6 +1360,14 @@ void Audio32::printAudioList(Console *con) const {
 		}
 	}
 
+	if (_mixStats.numBuffers) {
+		con->debugPrintf("\nMixed %u buffers (%u samples) in %u ms, %u us per buffer\n",
+						 _mixStats.numBuffers,
+						 _mixStats.numSamples,
+						 _mixStats.mixTime,
+						 _mixStats.mixTime * 1000 / _mixStats.numBuffers);
+	}
+
 	if (g_sci->_features->hasSci3Audio()) {
 		con->debugPrintf("\nLocks: ");
 		if (_lockedResourceIds.size()) {
@@ -212,7 +212,7 @@ private:
 	 * Determines whether or not the given audio channel will be mixed into the
 	 * output stream.
 	 */
-	bool channelShouldMix(const AudioChannel &channel) const;
+	bool channelShouldMix(const AudioChannel &channel, const uint32 now) const;
 
 	/**
 	 * Mixes audio from the given source stream into the target buffer using the
@@ -652,6 +652,33 @@ public:
 #pragma mark Debugging
 public:
 	void printAudioList(Console *con) const;
+
+private:
+	/**
+	 * Mixing statistics, accumulated across calls to `readBuffer`. The mix
+	 * time of a single buffer is usually well below the resolution of the
+	 * system timer, so only the total time is useful.
+	 */
+	struct MixStats {
+		/**
+		 * The number of output buffers that were mixed.
+		 */
+		uint32 numBuffers;
+
+		/**
+		 * The total number of output samples that were mixed.
+		 */
+		uint32 numSamples;
+
+		/**
+		 * The total time spent mixing, in milliseconds.
+		 */
+		uint32 mixTime;
+
+		MixStats() : numBuffers(0), numSamples(0), mixTime(0) {}
+	};
+
+	MixStats _mixStats;
 };
 
 } // End of namespace Sci
@@ -943,6 +943,20 @@ void RobotDecoder::AudioList::addBlock(const int position, const int size, const
 	++_blocksSize;
 }
 
+void RobotDecoder::AudioList::addBlockAndSubmit(const int position, const int size, const byte *data) {
+	// Packets are consumed by the audio stream in order, so the block can only
+	// skip the queue if nothing is waiting ahead of it
+	if (_blocksSize == 0) {
+		assert(data != nullptr);
+		RobotAudioStream::RobotAudioPacket packet(const_cast<byte *>(data), size, (position - _startOffset) * 2);
+		if (g_sci->_audio32->playRobotAudio(packet)) {
+			return;
+		}
+	}
+
+	addBlock(position, size, data);
+}
+
 void RobotDecoder::AudioList::reset() {
 	stopAudioNow();
 	_startOffset = 0;
@@ -1229,7 +1243,7 @@ void RobotDecoder::doRobot() {
 
 			int audioPosition, audioSize;
 			if (readAudioDataFromRecord(candidateFrameNo, _audioBuffer, audioPosition, audioSize)) {
-				_audioList.addBlock(audioPosition, audioSize, _audioBuffer);
+				_audioList.addBlockAndSubmit(audioPosition, audioSize, _audioBuffer);
 			}
 		}
 		_audioList.submitDriverMax();
@@ -1376,7 +1390,11 @@ void RobotDecoder::doVersion5(const bool shouldSubmitAudio) {
 		(getSciVersion() < SCI_VERSION_3 || shouldSubmitAudio)) {
 		int audioPosition, audioSize;
 		if (readAudioDataFromRecord(_currentFrameNo, _audioBuffer, audioPosition, audioSize)) {
-			_audioList.addBlock(audioPosition, audioSize, _audioBuffer);
+			if (shouldSubmitAudio) {
+				_audioList.addBlockAndSubmit(audioPosition, audioSize, _audioBuffer);
+			} else {
+				_audioList.addBlock(audioPosition, audioSize, _audioBuffer);
+			}
 		}
 	}
 
@@ -904,6 +904,16 @@ private:
 		 */
 		void addBlock(const int position, const int size, const byte *buffer);
 
+		/**
+		 * Submits a block of audio directly to the audio manager if no other
+		 * blocks are waiting to be submitted. The data is only copied into a
+		 * new queued AudioBlock if the audio manager could not accept all of
+		 * it.
+		 *
+		 * @see addBlock
+		 */
+		void addBlockAndSubmit(const int position, const int size, const byte *buffer);
+
 		/**
 		 * Immediately stops any active playback and purges all audio data in
 		 * the audio list.
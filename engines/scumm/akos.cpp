@@ -338,6 +338,7 @@ void AkosRenderer::setPalette(uint16 *new_palette) {
 void AkosRenderer::setCostume(int costume, int shadow) {
 	const byte *akos = _vm->getResourceAddress(rtCostume, costume);
 	assert(akos);
+	_costume = costume;
 
 	akhd = (const AkosHeader *) _vm->findResourceData(MKTAG('A','K','H','D'), akos);
 	akof = (const AkosOffset *) _vm->findResourceData(MKTAG('A','K','O','F'), akos);
@@ -1145,6 +1146,62 @@ void AkosRenderer::akos16DecodeLine(byte *buf, int32 numbytes, int32 dir) {
 	}
 }
 
+const byte *AkosRenderer::akos16GetDecodedImage(const byte *src) {
+	const uint32 size = _width * _height;
+	if (size > kAkos16CacheBudget / 4)
+		return NULL;
+
+	Akos16CacheKey key;
+	key.costume = _costume;
+	key.src = src;
+	key.width = _width;
+	key.height = _height;
+
+	Akos16Cache::iterator it = _akos16Cache.find(key);
+	if (it == _akos16Cache.end()) {
+		++_akos16CacheStats.misses;
+
+		if (_akos16CacheSize + size > kAkos16CacheBudget)
+			evictAkos16Images();
+
+		// The image data is a single stream of _width * _height pixels, so
+		// decode all of it in one go
+		Akos16CacheEntry &entry = _akos16Cache[key];
+		entry.pixels.resize(size);
+		akos16SetupBitReader(src);
+		akos16DecodeLine(entry.pixels.begin(), size, 1);
+
+		_akos16CacheSize += size;
+		it = _akos16Cache.find(key);
+	} else {
+		++_akos16CacheStats.hits;
+	}
+
+	it->_value.lastUsed = ++_akos16CacheClock;
+	return it->_value.pixels.begin();
+}
+
+void AkosRenderer::evictAkos16Images() {
+	// Throw out the least recently used images until the cache is back to
+	// three quarters of its budget, so eviction does not run on every miss
+	while (_akos16CacheSize > kAkos16CacheBudget * 3 / 4 && !_akos16Cache.empty()) {
+		Akos16Cache::iterator oldest = _akos16Cache.begin();
+		for (Akos16Cache::iterator it = _akos16Cache.begin(); it != _akos16Cache.end(); ++it) {
+			if (it->_value.lastUsed < oldest->_value.lastUsed)
+				oldest = it;
+		}
+
+		_akos16CacheSize -= oldest->_value.pixels.size();
+		_akos16Cache.erase(oldest);
+		++_akos16CacheStats.evictions;
+	}
+}
+
+void AkosRenderer::flushAkos16Cache() {
+	_akos16Cache.clear();
+	_akos16CacheSize = 0;
+}
+
 void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, int32 t_width, int32 t_height, int32 dir,
 		int32 numskip_before, int32 numskip_after, byte transparency, int maskLeft, int maskTop, int zBuf) {
 	byte *tmp_buf = _akos16.buffer;
@@ -1157,10 +1214,18 @@ void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, in
 		tmp_buf += (t_width - 1);
 	}
 
-	akos16SetupBitReader(src);
+	// Redrawing the same image (e.g. for an idle actor) only copies lines
+	// from the decoded image, instead of decoding the bit stream again
+	const byte *image = akos16GetDecodedImage(src);
 
-	if (numskip_before != 0) {
-		akos16SkipData(numskip_before);
+	if (image) {
+		image += numskip_before;
+	} else {
+		akos16SetupBitReader(src);
+
+		if (numskip_before != 0) {
+			akos16SkipData(numskip_before);
+		}
 	}
 
 	maskpitch = _numStrips;
@@ -1170,12 +1235,22 @@ void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, in
 	assert(t_height > 0);
 	assert(t_width > 0);
 	while (t_height--) {
-		akos16DecodeLine(tmp_buf, t_width, dir);
+		if (image) {
+			if (dir > 0) {
+				memcpy(_akos16.buffer, image, t_width);
+			} else {
+				for (int32 i = 0; i < t_width; ++i)
+					tmp_buf[-i] = image[i];
+			}
+			image += t_width + numskip_after;
+		} else {
+			akos16DecodeLine(tmp_buf, t_width, dir);
+		}
 		bompApplyMask(_akos16.buffer, maskptr, maskbit, t_width, transparency);
 		bool HE7Check = (_vm->_game.heversion == 70);
 		bompApplyShadow(_shadow_mode, _shadow_table, _akos16.buffer, dest, t_width, transparency, HE7Check);
 
-		if (numskip_after != 0)	{
+		if (!image && numskip_after != 0)	{
 			akos16SkipData(numskip_after);
 		}
 		dest += pitch;
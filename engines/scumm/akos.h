@@ -23,6 +23,9 @@
 #ifndef SCUMM_AKOS_H
 #define SCUMM_AKOS_H
 
+#include "common/array.h"
+#include "common/hashmap.h"
+
 #include "scumm/base-costume.h"
 
 namespace Scumm {
@@ -85,6 +88,57 @@ protected:
 		byte buffer[336];
 	} _akos16;
 
+	/** Number of the costume set with setCostume(). */
+	int _costume;
+
+public:
+	struct Akos16CacheStats {
+		uint32 hits;
+		uint32 misses;
+		uint32 evictions;
+	};
+
+protected:
+	/**
+	 * Key of a decoded codec 16 image. Costume resources are never
+	 * modified, so the costume number and the address of the compressed
+	 * data identify the image, even if the costume is expired and loaded
+	 * again elsewhere.
+	 */
+	struct Akos16CacheKey {
+		int costume;
+		const byte *src;
+		int width, height;
+
+		bool operator==(const Akos16CacheKey &other) const {
+			return costume == other.costume && src == other.src && width == other.width && height == other.height;
+		}
+	};
+
+	struct Akos16CacheKeyHash {
+		uint operator()(const Akos16CacheKey &key) const {
+			return (uint)(size_t)key.src ^ ((uint)key.costume << 16) ^ ((uint)key.width << 8) ^ (uint)key.height;
+		}
+	};
+
+	/** A fully decoded image, unclipped and unmirrored. */
+	struct Akos16CacheEntry {
+		Common::Array<byte> pixels;
+		uint32 lastUsed;
+	};
+
+	typedef Common::HashMap<Akos16CacheKey, Akos16CacheEntry, Akos16CacheKeyHash> Akos16Cache;
+
+	enum {
+		/** Maximum number of bytes of decoded images kept in the codec 16 cache. */
+		kAkos16CacheBudget = 1024 * 1024
+	};
+
+	Akos16Cache _akos16Cache;
+	uint32 _akos16CacheSize;
+	uint32 _akos16CacheClock;
+	Akos16CacheStats _akos16CacheStats;
+
 public:
 	AkosRenderer(ScummEngine *scumm) : BaseCostumeRenderer(scumm) {
 		_useBompPalette = false;
@@ -97,7 +151,11 @@ public:
 		akct = 0;
 		rgbs = 0;
 		xmap = 0;
+		_costume = 0;
 		_actorHitMode = false;
+		_akos16CacheSize = 0;
+		_akos16CacheClock = 0;
+		memset(&_akos16CacheStats, 0, sizeof(_akos16CacheStats));
 	}
 
 	bool _actorHitMode;
@@ -108,6 +166,11 @@ public:
 	void setFacing(const Actor *a);
 	void setCostume(int costume, int shadow);
 
+	void flushAkos16Cache();
+	const Akos16CacheStats &getAkos16CacheStats() const { return _akos16CacheStats; }
+	uint32 getAkos16CacheSize() const { return _akos16CacheSize; }
+	uint getNumCachedAkos16Images() const { return _akos16Cache.size(); }
+
 protected:
 	byte drawLimb(const Actor *a, int limb);
 
@@ -120,6 +183,8 @@ protected:
 	void akos16SkipData(int32 numskip);
 	void akos16DecodeLine(byte *buf, int32 numbytes, int32 dir);
 	void akos16Decompress(byte *dest, int32 pitch, const byte *src, int32 t_width, int32 t_height, int32 dir, int32 numskip_before, int32 numskip_after, byte transparency, int maskLeft, int maskTop, int zBuf);
+	const byte *akos16GetDecodedImage(const byte *src);
+	void evictAkos16Images();
 
 	void markRectAsDirty(Common::Rect rect);
 };
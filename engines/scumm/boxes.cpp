@@ -87,6 +87,7 @@ struct Box {				/* Internal walkbox file format */
 
 
 static void getGates(const BoxCoords &box1, const BoxCoords &box2, Common::Point gateA[2], Common::Point gateB[2]);
+static bool boxesTouch(BoxCoords box2, BoxCoords box);
 
 static bool compareSlope(const Common::Point &p1, const Common::Point &p2, const Common::Point &p3) {
 	return (p2.y - p1.y) * (p3.x - p1.x) <= (p3.y - p1.y) * (p2.x - p1.x);
@@ -571,7 +572,46 @@ bool ScummEngine::checkXYInBoxBounds(int boxnum, int x, int y) {
 	return true;
 }
 
+/**
+ * Rebuild the walkbox cache if the box resources were replaced since it
+ * was last built. The box data changes on room changes and when scripts
+ * switch box sets. The box matrix is also rebuilt by createBoxMatrix(),
+ * which only invalidates the decoded routes.
+ */
+void ScummEngine::updateBoxCache() {
+	const uint32 matrixGeneration = _res->getResourceGeneration(rtMatrix, 1);
+	if (_boxCache.matrixGeneration != matrixGeneration) {
+		_boxCache.matrixGeneration = matrixGeneration;
+		_boxCache.nextBox.clear();
+	}
+
+	const uint32 boxGeneration = _res->getResourceGeneration(rtMatrix, 2);
+	if (_boxCache.boxGeneration == boxGeneration)
+		return;
+
+	_boxCache.boxGeneration = boxGeneration;
+	_boxCache.numBoxes = getNumBoxes();
+
+	_boxCache.coords.resize(_boxCache.numBoxes);
+	for (int i = 0; i < _boxCache.numBoxes; i++)
+		_boxCache.coords[i] = readBoxCoordinates(i);
+
+	_boxCache.neighbors.resize(_boxCache.numBoxes * _boxCache.numBoxes);
+	Common::fill(_boxCache.neighbors.begin(), _boxCache.neighbors.end(), 0);
+
+	_boxCache.nextBox.clear();
+}
+
 BoxCoords ScummEngine::getBoxCoordinates(int boxnum) {
+	updateBoxCache();
+	if (boxnum >= 0 && boxnum < _boxCache.numBoxes)
+		return _boxCache.coords[boxnum];
+
+	// Out of range requests go through the workarounds in getBoxBaseAddr()
+	return readBoxCoordinates(boxnum);
+}
+
+BoxCoords ScummEngine::readBoxCoordinates(int boxnum) {
 	BoxCoords tmp, *box = &tmp;
 	Box *bp = getBoxBaseAddr(boxnum);
 	assert(bp);
@@ -716,9 +756,7 @@ byte *ScummEngine::getBoxConnectionBase(int box) {
  */
 int ScummEngine::getNextBox(byte from, byte to) {
 	const byte *boxm;
-	byte i;
 	const int numOfBoxes = getNumBoxes();
-	int dest = -1;
 
 	if (from == to)
 		return to;
@@ -754,7 +792,31 @@ int ScummEngine::getNextBox(byte from, byte to) {
 		return (int8)boxm[to];
 	}
 
-	// WORKAROUND #1: It seems that in some cases, the box matrix is corrupt
+	// WORKAROUND: In addition to the truncated box matrix handled in
+	// buildNextBoxTable(), we have to add this special case to fix the
+	// scene in Indy3 where Indy meets Hitler in Berlin.
+	// See bug #770690 and also bug #774783.
+	if ((_game.id == GID_INDY3) && _roomResource == 46 && from == 1 && to == 0)
+		return 0;
+
+	updateBoxCache();
+	if (_boxCache.nextBox.empty())
+		buildNextBoxTable();
+
+	return _boxCache.nextBox[from * numOfBoxes + to];
+}
+
+/**
+ * Decode the compressed box matrix of v3+ games into a dense table, so
+ * getNextBox() is a single lookup instead of a scan over the matrix.
+ * Later triples in a row override earlier ones, like they did when the
+ * matrix was searched directly.
+ */
+void ScummEngine::buildNextBoxTable() {
+	const int numOfBoxes = _boxCache.numBoxes;
+	const byte *boxm = getBoxMatrixBaseAddr();
+
+	// WORKAROUND: It seems that in some cases, the box matrix is corrupt
 	// (more precisely, is too short) in the datafiles already. In
 	// particular this seems to be the case in room 46 of Indy3 EGA (see
 	// also bug #770690). This didn't cause problems in the original
@@ -764,33 +826,27 @@ int ScummEngine::getNextBox(byte from, byte to) {
 	// since random data may follow after the resource in ScummVM.
 	//
 	// As a workaround, we add a check for the end of the box matrix
-	// resource, and abort the search once we reach the end.
+	// resource, and abort the decoding once we reach the end.
 	const byte *end = boxm + getResourceSize(rtMatrix, 1);
 
-	// WORKAROUND #2: In addition to the above, we have to add this special
-	// case to fix the scene in Indy3 where Indy meets Hitler in Berlin.
-	// See bug #770690 and also bug #774783.
-	if ((_game.id == GID_INDY3) && _roomResource == 46 && from == 1 && to == 0)
-		return 0;
+	_boxCache.nextBox.resize(numOfBoxes * numOfBoxes);
+	Common::fill(_boxCache.nextBox.begin(), _boxCache.nextBox.end(), -1);
+
+	for (int from = 0; from < numOfBoxes; from++) {
+		int8 *row = &_boxCache.nextBox[from * numOfBoxes];
 
-	// Skip up to the matrix data for box 'from'
-	for (i = 0; i < from && boxm < end; i++) {
-		while (boxm < end && *boxm != 0xFF)
+		while (boxm < end && boxm[0] != 0xFF) {
+			for (int to = boxm[0]; to <= boxm[1] && to < numOfBoxes; to++)
+				row[to] = (int8)boxm[2];
 			boxm += 3;
-		boxm++;
-	}
+		}
 
-	// Now search for the entry for box 'to'
-	while (boxm < end && boxm[0] != 0xFF) {
-		if (boxm[0] <= to && to <= boxm[1])
-			dest = (int8)boxm[2];
-		boxm += 3;
+		if (boxm >= end) {
+			debug(0, "The box matrix apparently is truncated (room %d)", _roomResource);
+			break;
+		}
+		boxm++;
 	}
-
-	if (boxm >= end)
-		debug(0, "The box matrix apparently is truncated (room %d)", _roomResource);
-
-	return dest;
 }
 
 /*
@@ -1076,16 +1132,27 @@ void ScummEngine::createBoxMatrix() {
 
 /** Check if two boxes are neighbors. */
 bool ScummEngine::areBoxesNeighbors(int box1nr, int box2nr) {
-	Common::Point tmp;
-	BoxCoords box;
-	BoxCoords box2;
-
 	if ((getBoxFlags(box1nr) & kBoxInvisible) || (getBoxFlags(box2nr) & kBoxInvisible))
 		return false;
 
 	assert(_game.version >= 3);
-	box2 = getBoxCoordinates(box1nr);
-	box = getBoxCoordinates(box2nr);
+
+	// The geometry of the boxes only changes with the box resources, so
+	// the box matrix can be recomputed after a flag change without
+	// comparing all box sides again.
+	updateBoxCache();
+	if (box1nr < 0 || box1nr >= _boxCache.numBoxes || box2nr < 0 || box2nr >= _boxCache.numBoxes)
+		return boxesTouch(getBoxCoordinates(box1nr), getBoxCoordinates(box2nr));
+
+	byte &touching = _boxCache.neighbors[box1nr * _boxCache.numBoxes + box2nr];
+	if (!touching)
+		touching = boxesTouch(_boxCache.coords[box1nr], _boxCache.coords[box2nr]) ? 2 : 1;
+	return touching == 2;
+}
+
+/** Check if a side of box2 touches a side of box. */
+static bool boxesTouch(BoxCoords box2, BoxCoords box) {
+	Common::Point tmp;
 
 	// Roughly, the idea of this algorithm is to search for sies of the given
 	// boxes that touch each other.
@@ -27,13 +27,25 @@
 #include "common/util.h"
 
 #include "scumm/actor.h"
+#include "scumm/akos.h"
 #include "scumm/boxes.h"
 #include "scumm/debugger.h"
+#include "scumm/gfx.h"
 #include "scumm/imuse/imuse.h"
 #include "scumm/object.h"
 #include "scumm/resource.h"
 #include "scumm/scumm.h"
 #include "scumm/sound.h"
+#ifdef ENABLE_SCUMM_7_8
+#include "scumm/imuse_digi/dimuse.h"
+#include "scumm/scumm_v7.h"
+#include "scumm/smush/smush_player.h"
+#endif
+#ifdef ENABLE_HE
+#include "scumm/he/intern_he.h"
+#include "scumm/he/sprite_he.h"
+#include "scumm/he/wiz_he.h"
+#endif
 
 namespace Scumm {
 
@@ -97,6 +109,25 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 	registerCmd("imuse",     WRAP_METHOD(ScummDebugger, Cmd_IMuse));
 
 	registerCmd("resetcursors",    WRAP_METHOD(ScummDebugger, Cmd_ResetCursors));
+
+	registerCmd("stripcache",      WRAP_METHOD(ScummDebugger, Cmd_StripCache));
+	registerCmd("screenupdates",   WRAP_METHOD(ScummDebugger, Cmd_ScreenUpdates));
+	registerCmd("resources",       WRAP_METHOD(ScummDebugger, Cmd_Resources));
+	if (_vm->_game.features & GF_NEW_COSTUMES)
+		registerCmd("costumecache",    WRAP_METHOD(ScummDebugger, Cmd_CostumeCache));
+
+#ifdef ENABLE_SCUMM_7_8
+	if (_vm->_game.version >= 7)
+		registerCmd("smush",     WRAP_METHOD(ScummDebugger, Cmd_Smush));
+	if (_vm->_imuseDigital)
+		registerCmd("imusedigi", WRAP_METHOD(ScummDebugger, Cmd_IMuseDigital));
+#endif
+#ifdef ENABLE_HE
+	if (_vm->_game.heversion >= 71)
+		registerCmd("wizbench",  WRAP_METHOD(ScummDebugger, Cmd_WizBench));
+	if (_vm->_game.heversion >= 90)
+		registerCmd("sprites",   WRAP_METHOD(ScummDebugger, Cmd_Sprites));
+#endif
 }
 
 ScummDebugger::~ScummDebugger() {
@@ -547,6 +578,189 @@ bool ScummDebugger::Cmd_Camera(int argc, const char **argv) {
 	return true;
 }
 
+bool ScummDebugger::Cmd_ScreenUpdates(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset"))) {
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	if (argc == 2) {
+		_vm->resetScreenUpdateStats();
+		debugPrintf("Screen update statistics reset\n");
+		return true;
+	}
+
+	const ScummEngine::ScreenUpdateStats &stats = _vm->getScreenUpdateStats();
+	debugPrintf("Frames: %d, rects uploaded: %d, pixels uploaded: %d\n", stats.frames, stats.uploads, stats.uploadedPixels);
+	if (stats.frames)
+		debugPrintf("Per frame: %d rects, %d pixels\n", stats.uploads / stats.frames, stats.uploadedPixels / stats.frames);
+
+	return true;
+}
+
+bool ScummDebugger::Cmd_StripCache(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "flush"))) {
+		debugPrintf("Usage: %s [flush]\n", argv[0]);
+		return true;
+	}
+
+	if (argc == 2) {
+		_vm->_gdi->flushStripCache();
+		debugPrintf("Strip cache flushed\n");
+		return true;
+	}
+
+	const Gdi::StripCacheStats &stats = _vm->_gdi->getStripCacheStats();
+	const uint32 lookups = stats.hits + stats.misses;
+	debugPrintf("Strip cache: %d strips, %d bytes\n", _vm->_gdi->getNumCachedStrips(), _vm->_gdi->getStripCacheSize());
+	debugPrintf("Hits: %d, misses: %d (%d uncacheable), hit rate: %d%%\n",
+		stats.hits, stats.misses, stats.uncacheable, lookups ? stats.hits * 100 / lookups : 0);
+	debugPrintf("Evictions: %d, flushes: %d\n", stats.evictions, stats.flushes);
+
+	return true;
+}
+
+bool ScummDebugger::Cmd_CostumeCache(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "flush"))) {
+		debugPrintf("Usage: %s [flush]\n", argv[0]);
+		return true;
+	}
+
+	AkosRenderer *renderer = (AkosRenderer *)_vm->_costumeRenderer;
+
+	if (argc == 2) {
+		renderer->flushAkos16Cache();
+		debugPrintf("Costume cache flushed\n");
+		return true;
+	}
+
+	const AkosRenderer::Akos16CacheStats &stats = renderer->getAkos16CacheStats();
+	const uint32 lookups = stats.hits + stats.misses;
+	debugPrintf("Codec 16 image cache: %d images, %d bytes\n", renderer->getNumCachedAkos16Images(), renderer->getAkos16CacheSize());
+	debugPrintf("Hits: %d, misses: %d, hit rate: %d%%, evictions: %d\n",
+		stats.hits, stats.misses, lookups ? stats.hits * 100 / lookups : 0, stats.evictions);
+
+	return true;
+}
+
+bool ScummDebugger::Cmd_Resources(int argc, const char **argv) {
+	const ResourceManager::Stats &stats = _vm->_res->getStats();
+	debugPrintf("Heap: %d of %d bytes in use\n", _vm->_res->getAllocatedSize(), _vm->_res->getMaxHeapThreshold());
+	debugPrintf("Demand loads: %d, %d ms total, %d ms max\n", stats.demandLoads, stats.demandLoadTime, stats.maxDemandLoadTime);
+	debugPrintf("Prefetched: %d\n", stats.prefetchLoads);
+	debugPrintf("Expired: %d (%d bytes)\n", stats.evictions, stats.evictedSize);
+
+	return true;
+}
+
+#ifdef ENABLE_HE
+bool ScummDebugger::Cmd_WizBench(int argc, const char **argv) {
+	static const struct {
+		int comp;
+		const char *desc;
+	} types[] = {
+		{ 0, "8 bit raw" },
+		{ 1, "8 bit RLE" },
+		{ 2, "16 bit raw" },
+		{ 5, "16 bit RLE" }
+	};
+
+	if (argc > 2) {
+		debugPrintf("Usage: %s [iterations]\n", argv[0]);
+		return true;
+	}
+
+	const int iterations = (argc == 2) ? MAX(1, atoi(argv[1])) : 100;
+	for (int i = 0; i < ARRAYSIZE(types); ++i) {
+		const int32 time = Wiz::benchmarkDecoder(types[i].comp, iterations);
+		if (time < 0)
+			debugPrintf("Type %d (%s): not supported\n", types[i].comp, types[i].desc);
+		else
+			debugPrintf("Type %d (%s): %d ms for %d 640x480 images\n", types[i].comp, types[i].desc, time, iterations);
+	}
+
+	return true;
+}
+
+bool ScummDebugger::Cmd_Sprites(int argc, const char **argv) {
+	Sprite *sprite = ((ScummEngine_v90he *)_vm)->_sprite;
+
+	if (argc > 1) {
+		if (!strcmp(argv[1], "reset")) {
+			sprite->resetFrameStats();
+			debugPrintf("Sprite statistics reset\n");
+		} else {
+			debugPrintf("Usage: %s [reset]\n", argv[0]);
+		}
+		return true;
+	}
+
+	const Sprite::FrameStats &stats = sprite->getFrameStats();
+	if (!stats.frames) {
+		debugPrintf("No sprite frames have been processed yet\n");
+		return true;
+	}
+
+	debugPrintf("Frames: %d, sorted list rebuilt in %d\n", stats.frames, stats.listRebuilds);
+	debugPrintf("Last frame: %d active sprites, %d redrawn\n", stats.activeSprites, stats.redrawnSprites);
+	debugPrintf("Processing: %d ms total, %d ms average, %d ms max, %d ms last frame\n",
+		stats.totalTime, stats.totalTime / stats.frames, stats.maxFrameTime, stats.lastFrameTime);
+
+	return true;
+}
+#endif
+
+#ifdef ENABLE_SCUMM_7_8
+bool ScummDebugger::Cmd_Smush(int argc, const char **argv) {
+	SmushPlayer *player = ((ScummEngine_v7 *)_vm)->_splayer;
+	if (!player) {
+		debugPrintf("No SMUSH player\n");
+		return true;
+	}
+
+	const SmushPlayer::FrameStats &stats = player->getFrameStats();
+	if (!stats.frames) {
+		debugPrintf("No SMUSH frames have been played yet\n");
+		return true;
+	}
+
+	debugPrintf("Frames: %d, skipped: %d\n", stats.frames, stats.skippedFrames);
+	debugPrintf("Decoding: %d ms total, %d ms average, %d ms max, %d ms last frame\n",
+		stats.decodeTime, stats.decodeTime / stats.frames, stats.maxDecodeTime, stats.lastDecodeTime);
+	debugPrintf("Frame handling: %d ms total, %d ms average, %d ms max\n",
+		stats.frameTime, stats.frameTime / stats.frames, stats.maxFrameTime);
+
+	return true;
+}
+
+bool ScummDebugger::Cmd_IMuseDigital(int argc, const char **argv) {
+	IMuseDigital *imuse = _vm->_imuseDigital;
+
+	if (argc > 1) {
+		if (!strcmp(argv[1], "reset")) {
+			imuse->resetStreamStats();
+			debugPrintf("iMUSE Digital statistics reset\n");
+		} else {
+			debugPrintf("Usage: imusedigi [reset]\n");
+		}
+		return true;
+	}
+
+	const IMuseDigital::StreamStats stats = imuse->getStreamStats();
+	int numCachedBlocks;
+	const BundleDirCache::BlockCacheStats blocks = imuse->getBlockCacheStats(numCachedBlocks);
+
+	debugPrintf("Underruns: %d", stats.underruns);
+	if (stats.lastUnderrunSoundId != -1)
+		debugPrintf(" (last in sound %d)", stats.lastUnderrunSoundId);
+	debugPrintf("\n");
+	debugPrintf("Bundle blocks: %d/%d cached, %d hits, %d decoded on demand, %d decoded ahead, %d evicted\n",
+		numCachedBlocks, BundleDirCache::kMaxCachedBlocks, blocks.hits, blocks.misses, blocks.decodedAhead, blocks.evictions);
+
+	return true;
+}
+#endif
+
 bool ScummDebugger::Cmd_PrintBox(int argc, const char **argv) {
 	int num, i = 0;
 
@@ -69,6 +69,20 @@ private:
 
 	bool Cmd_ResetCursors(int argc, const char **argv);
 
+	bool Cmd_StripCache(int argc, const char **argv);
+	bool Cmd_ScreenUpdates(int argc, const char **argv);
+	bool Cmd_Resources(int argc, const char **argv);
+	bool Cmd_CostumeCache(int argc, const char **argv);
+
+#ifdef ENABLE_SCUMM_7_8
+	bool Cmd_Smush(int argc, const char **argv);
+	bool Cmd_IMuseDigital(int argc, const char **argv);
+#endif
+#ifdef ENABLE_HE
+	bool Cmd_WizBench(int argc, const char **argv);
+	bool Cmd_Sprites(int argc, const char **argv);
+#endif
+
 	void printBox(int box);
 	void drawBox(int box);
 };
@@ -215,6 +215,12 @@ Gdi::Gdi(ScummEngine *vm) : _vm(vm) {
 	_zbufferDisabled = false;
 	_objectMode = false;
 	_distaff = false;
+
+	_useStripCache = false;
+	_stripCacheSize = 0;
+	_stripCacheClock = 0;
+	memset(&_stripCacheStats, 0, sizeof(_stripCacheStats));
+	memset(_stripCachePalette, 0, sizeof(_stripCachePalette));
 }
 
 Gdi::~Gdi() {
@@ -275,6 +281,7 @@ void Gdi::init() {
 }
 
 void Gdi::roomChanged(byte *roomptr) {
+	flushStripCache();
 }
 
 void GdiNES::roomChanged(byte *roomptr) {
@@ -504,6 +511,8 @@ void ScummEngine::markRectAsDirty(VirtScreenNumber virt, int left, int right, in
  * code in the backend is controlled from here.
  */
 void ScummEngine::drawDirtyScreenParts() {
+	_screenUpdateStats.frames++;
+
 	// Update verbs
 	updateDirtyScreen(kVerbVirtScreen);
 
@@ -574,27 +583,51 @@ void ScummEngine::updateDirtyScreen(VirtScreenNumber slot) {
 	if (vs->h == 0)
 		return;
 
-	int i;
-	int w = 8;
-	int start = 0;
+	// Neighboring dirty strips are coalesced into one rectangle spanning
+	// all their dirty ranges, as long as that does not more than double
+	// the number of pixels to blit. Blitting a clean area again is
+	// harmless, while every rectangle costs a call into the backend.
+	int start = -1;
+	int runTop = 0, runBottom = 0, runArea = 0;
+
+	for (int i = 0; i < _gdi->_numStrips; i++) {
+		const int top = vs->tdirty[i];
+		const int bottom = vs->bdirty[i];
 
-	for (i = 0; i < _gdi->_numStrips; i++) {
-		if (vs->bdirty[i]) {
-			const int top = vs->tdirty[i];
-			const int bottom = vs->bdirty[i];
+		if (bottom) {
 			vs->tdirty[i] = vs->h;
 			vs->bdirty[i] = 0;
-			if (i != (_gdi->_numStrips - 1) && vs->bdirty[i + 1] == bottom && vs->tdirty[i + 1] == top) {
-				// Simple optimizations: if two or more neighboring strips
-				// form one bigger rectangle, coalesce them.
-				w += 8;
+		}
+
+		if (bottom <= top) {
+			if (start != -1) {
+				drawStripToScreen(vs, start * 8, (i - start) * 8, runTop, runBottom);
+				start = -1;
+			}
+			continue;
+		}
+
+		if (start != -1) {
+			const int unionTop = MIN(runTop, top);
+			const int unionBottom = MAX(runBottom, bottom);
+			const int area = runArea + (bottom - top);
+			if ((i - start + 1) * (unionBottom - unionTop) <= 2 * area) {
+				runTop = unionTop;
+				runBottom = unionBottom;
+				runArea = area;
 				continue;
 			}
-			drawStripToScreen(vs, start * 8, w, top, bottom);
-			w = 8;
+			drawStripToScreen(vs, start * 8, (i - start) * 8, runTop, runBottom);
 		}
-		start = i + 1;
+
+		start = i;
+		runTop = top;
+		runBottom = bottom;
+		runArea = bottom - top;
 	}
+
+	if (start != -1)
+		drawStripToScreen(vs, start * 8, (_gdi->_numStrips - start) * 8, runTop, runBottom);
 }
 
 /**
@@ -664,22 +697,36 @@ void ScummEngine::drawStripToScreen(VirtScreen *vs, int x, int width, int top, i
 			const byte *srcPtr = (const byte *)src;
 			const byte *textPtr = (byte *)_textSurface.getBasePtr(x * m, y * m);
 			byte *dstPtr = _compositeBuf;
+			const int textWidth = width * m;
+
+			assert(vs->format.bytesPerPixel == 2);
 
 			for (int h = 0; h < height * m; ++h) {
-				for (int w = 0; w < width * m; ++w) {
-					uint16 tmp = *textPtr++;
-					if (tmp == CHARSET_MASK_TRANSPARENCY) {
-						tmp = READ_UINT16(srcPtr);
-						WRITE_UINT16(dstPtr, tmp); dstPtr += 2;
-					} else if (_game.heversion != 0) {
-						error ("16Bit Color HE Game using old charset");
-					} else {
-						WRITE_UINT16(dstPtr, _16BitPalette[tmp]); dstPtr += 2;
+				int w = 0;
+				while (w < textWidth) {
+					// Most of the text surface is transparent, so copy the
+					// game graphics below it a run at a time.
+					int run = 0;
+					while (w + run < textWidth && textPtr[run] == CHARSET_MASK_TRANSPARENCY)
+						++run;
+					if (run) {
+						memcpy(dstPtr, srcPtr, run * 2);
+						dstPtr += run * 2;
+						srcPtr += run * 2;
+						textPtr += run;
+						w += run;
+						continue;
 					}
-					srcPtr += vs->format.bytesPerPixel;
+
+					if (_game.heversion != 0)
+						error ("16Bit Color HE Game using old charset");
+
+					WRITE_UINT16(dstPtr, _16BitPalette[*textPtr++]); dstPtr += 2;
+					srcPtr += 2;
+					++w;
 				}
 				srcPtr += vsPitch;
-				textPtr += _textSurface.pitch - width * m;
+				textPtr += _textSurface.pitch - textWidth;
 			}
 		} else {
 #ifdef USE_ARM_GFX_ASM
@@ -765,6 +812,8 @@ void ScummEngine::drawStripToScreen(VirtScreen *vs, int x, int width, int top, i
 
 	// Finally blit the whole thing to the screen
 	_system->copyRectToScreen(src, pitch, x, y, width, height);
+	_screenUpdateStats.uploads++;
+	_screenUpdateStats.uploadedPixels += width * height;
 }
 
 // CGA
@@ -1008,7 +1057,7 @@ void ScummEngine::redrawBGStrip(int start, int num) {
 	else
 		room = getResourceAddress(rtRoom, _roomResource);
 
-	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, 0);
+	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, Gdi::dbRoomBackground);
 }
 
 void ScummEngine::restoreBackground(Common::Rect rect, byte backColor) {
@@ -1800,6 +1849,22 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 	_objectMode = (flag & dbObjectMode) == dbObjectMode;
 	prepareDrawBitmap(ptr, vs, x, y, width, height, stripnr, numstrip);
 
+	// Only the room background is cached. Its resource stays loaded for as
+	// long as the room is current, while object images are drawn with
+	// transparency over whatever is already there.
+	// Indy4 Amiga switches palettes per virtual screen in drawStrip(), and
+	// HE games use their own palettes and pixel formats, so both are left out.
+	_useStripCache = (flag & dbRoomBackground) && !_objectMode &&
+		vs->format.bytesPerPixel == 1 && _vm->_game.heversion == 0 &&
+		!(_vm->_game.platform == Common::kPlatformAmiga && _vm->_game.id == GID_INDY4);
+
+	if (_useStripCache && memcmp(_stripCachePalette, _roomPalette, sizeof(_stripCachePalette))) {
+		// The room palette was remapped by a script, so previously decoded
+		// strips have the wrong colors
+		flushStripCache();
+		memcpy(_stripCachePalette, _roomPalette, sizeof(_stripCachePalette));
+	}
+
 	sx = x - vs->xstart / 8;
 	if (sx < 0) {
 		numstrip -= -sx;
@@ -1913,6 +1978,9 @@ bool Gdi::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width,
 			_roomPalette = _vm->_roomPalette;
 	}
 
+	if (_useStripCache)
+		return drawCachedStrip(dstPtr, vs->pitch, smap_ptr + offset, height);
+
 	return decompressBitmap(dstPtr, vs->pitch, smap_ptr + offset, height);
 }
 
@@ -2427,6 +2495,107 @@ bool Gdi::decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLine
 	return transpStrip;
 }
 
+#pragma mark -
+#pragma mark --- Strip cache ---
+#pragma mark -
+
+bool Gdi::isOpaqueStripCode(byte code) const {
+	// EGA strips have no transparency
+	if (_vm->_game.features & GF_16COLOR)
+		return true;
+
+	// The codecs decompressBitmap() runs without transparency checks
+	switch (code) {
+	case 1:
+	case 2:
+	case 3:
+	case 4:
+	case 7:
+	case 9:
+	case 10:
+		return true;
+	default:
+		break;
+	}
+
+	return (code >= 14 && code <= 18) ||
+		(code >= 24 && code <= 28) ||
+		(code >= 64 && code <= 68) ||
+		(code >= 104 && code <= 108) ||
+		(code >= 134 && code <= 138);
+}
+
+bool Gdi::drawCachedStrip(byte *dst, int dstPitch, const byte *src, int height) {
+	StripCacheKey key;
+	key.src = src;
+	key.height = height;
+
+	StripCache::iterator it = _stripCache.find(key);
+	if (it == _stripCache.end()) {
+		++_stripCacheStats.misses;
+
+		// Transparent strips depend on what is already in the destination
+		if (!isOpaqueStripCode(*src)) {
+			++_stripCacheStats.uncacheable;
+			return decompressBitmap(dst, dstPitch, src, height);
+		}
+
+		StripCacheEntry &entry = _stripCache[key];
+		entry.pixels.resize(8 * height);
+
+		// Vertical codecs step back to the next column using the pitch of
+		// the destination, which is 8 for cached strips
+		const uint32 vertStripNextInc = _vertStripNextInc;
+		_vertStripNextInc = height * 8 - 1;
+		decompressBitmap(entry.pixels.begin(), 8, src, height);
+		_vertStripNextInc = vertStripNextInc;
+
+		_stripCacheSize += entry.pixels.size();
+		it = _stripCache.find(key);
+	} else {
+		++_stripCacheStats.hits;
+	}
+
+	StripCacheEntry &entry = it->_value;
+	entry.lastUsed = ++_stripCacheClock;
+
+	const byte *pixels = entry.pixels.begin();
+	for (int h = 0; h < height; ++h) {
+		memcpy(dst, pixels, 8);
+		dst += dstPitch;
+		pixels += 8;
+	}
+
+	if (_stripCacheSize > kStripCacheBudget)
+		evictStrips();
+
+	return false;
+}
+
+void Gdi::evictStrips() {
+	// Throw out the least recently used strips until the cache is back to
+	// three quarters of its budget, so eviction does not run on every miss
+	while (_stripCacheSize > kStripCacheBudget * 3 / 4 && _stripCache.size() > 1) {
+		StripCache::iterator oldest = _stripCache.begin();
+		for (StripCache::iterator it = _stripCache.begin(); it != _stripCache.end(); ++it) {
+			if (it->_value.lastUsed < oldest->_value.lastUsed)
+				oldest = it;
+		}
+
+		_stripCacheSize -= oldest->_value.pixels.size();
+		_stripCache.erase(oldest);
+		++_stripCacheStats.evictions;
+	}
+}
+
+void Gdi::flushStripCache() {
+	if (!_stripCache.empty())
+		++_stripCacheStats.flushes;
+
+	_stripCache.clear();
+	_stripCacheSize = 0;
+}
+
 void Gdi::decompressMaskImg(byte *dst, const byte *src, int height) const {
 	byte b, c;
 
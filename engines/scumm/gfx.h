@@ -24,6 +24,8 @@
 #define SCUMM_GFX_H
 
 #include "common/system.h"
+#include "common/array.h"
+#include "common/hashmap.h"
 #include "common/list.h"
 
 #include "graphics/surface.h"
@@ -209,6 +211,60 @@ protected:
 	/** Flag which is true when an object is being rendered, false otherwise. */
 	bool _objectMode;
 
+	/** Flag which is true when the strips being drawn may be served from the strip cache. */
+	bool _useStripCache;
+
+public:
+	struct StripCacheStats {
+		uint32 hits;
+		uint32 misses;
+		uint32 uncacheable;
+		uint32 evictions;
+		uint32 flushes;
+	};
+
+protected:
+	/**
+	 * Key of a decoded room background strip. The room resource stays
+	 * loaded while the room is current, so the address of the compressed
+	 * strip data identifies the strip (including the room image state).
+	 */
+	struct StripCacheKey {
+		const byte *src;
+		int height;
+
+		bool operator==(const StripCacheKey &other) const {
+			return src == other.src && height == other.height;
+		}
+	};
+
+	struct StripCacheKeyHash {
+		uint operator()(const StripCacheKey &key) const {
+			return (uint)(size_t)key.src ^ ((uint)key.height << 16);
+		}
+	};
+
+	/** An 8 pixel wide decoded strip, stored with a pitch of 8. */
+	struct StripCacheEntry {
+		Common::Array<byte> pixels;
+		uint32 lastUsed;
+	};
+
+	typedef Common::HashMap<StripCacheKey, StripCacheEntry, StripCacheKeyHash> StripCache;
+
+	enum {
+		/** Maximum number of bytes of decoded strips kept in the strip cache. */
+		kStripCacheBudget = 512 * 1024
+	};
+
+	StripCache _stripCache;
+	uint32 _stripCacheSize;
+	uint32 _stripCacheClock;
+	StripCacheStats _stripCacheStats;
+
+	/** Copy of the room palette the cached strips were decoded with. */
+	byte _stripCachePalette[256];
+
 public:
 	/** Flag which is true when loading objects or titles for distaff, in PCEngine version of Loom. */
 	bool _distaff;
@@ -237,6 +293,11 @@ protected:
 	void drawStripHE(byte *dst, int dstPitch, const byte *src, int width, int height, const bool transpCheck) const;
 	virtual void writeRoomColor(byte *dst, byte color) const;
 
+	/* Strip cache */
+	bool isOpaqueStripCode(byte code) const;
+	bool drawCachedStrip(byte *dst, int dstPitch, const byte *src, int height);
+	void evictStrips();
+
 	/* Mask decompressors */
 	void decompressMaskImgOr(byte *dst, const byte *src, int height) const;
 	void decompressMaskImg(byte *dst, const byte *src, int height) const;
@@ -279,10 +340,16 @@ public:
 
 	void resetBackground(int top, int bottom, int strip);
 
+	void flushStripCache();
+	const StripCacheStats &getStripCacheStats() const { return _stripCacheStats; }
+	uint32 getStripCacheSize() const { return _stripCacheSize; }
+	uint getNumCachedStrips() const { return _stripCache.size(); }
+
 	enum DrawBitmapFlags {
-		dbAllowMaskOr   = 1 << 0,
-		dbDrawMaskOnAll = 1 << 1,
-		dbObjectMode    = 2 << 2
+		dbAllowMaskOr    = 1 << 0,
+		dbDrawMaskOnAll  = 1 << 1,
+		dbObjectMode     = 2 << 2,
+		dbRoomBackground = 1 << 4
 	};
 };
 
@@ -444,6 +444,7 @@ class ScummEngine_v90he : public ScummEngine_v80he {
 	friend class LogicHE;
 	friend class Moonbase;
 	friend class MoviePlayer;
+	friend class ScummDebugger;
 	friend class Sprite;
 
 protected:
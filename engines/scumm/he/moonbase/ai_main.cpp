@@ -226,6 +226,7 @@ int AI::masterControlProgram(const int paramCount, const int32 *params) {
 	static int index;
 
 	_mcpParams = params;
+	_queryCache.clear(true);
 
 	static int lastSource[5];
 	static int lastAngle[5];
@@ -2401,22 +2402,60 @@ int *AI::defendTarget(int &targetX, int &targetY, int index) {
 	return retVal;
 }
 
+int AI::cachedQuery(const QueryKey &key) {
+	QueryCache::const_iterator it = _queryCache.find(key);
+	if (it != _queryCache.end())
+		return it->_value;
+
+	const int32 *a = key.args;
+	int retVal;
+	if (key.numArgs == 4)
+		retVal = _vm->_moonbase->callScummFunction(_mcpParams[key.func], 4, a[0], a[1], a[2], a[3]);
+	else if (key.numArgs == 7)
+		retVal = _vm->_moonbase->callScummFunction(_mcpParams[key.func], 7, a[0], a[1], a[2], a[3], a[4], a[5], a[6]);
+	else
+		retVal = _vm->_moonbase->callScummFunction(_mcpParams[key.func], 8, a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7]);
+
+	_queryCache[key] = retVal;
+	return retVal;
+}
+
 int AI::getClosestUnit(int x, int y, int radius, int player, int alignment, int unitType, int checkUnitEnabled) {
 	assert((unitType >= 0) && (unitType <= 12));
 
-	int retVal = _vm->_moonbase->callScummFunction(_mcpParams[F_GET_CLOSEST_UNIT], 7, x, y, radius, player, alignment, unitType, checkUnitEnabled);
-	return retVal;
+	QueryKey key(F_GET_CLOSEST_UNIT, 7);
+	key.args[0] = x;
+	key.args[1] = y;
+	key.args[2] = radius;
+	key.args[3] = player;
+	key.args[4] = alignment;
+	key.args[5] = unitType;
+	key.args[6] = checkUnitEnabled;
+	return cachedQuery(key);
 }
 
 int AI::getClosestUnit(int x, int y, int radius, int player, int alignment, int unitType, int checkUnitEnabled, int minDist) {
 	assert((unitType >= 0) && (unitType <= 12));
-	int retVal = _vm->_moonbase->callScummFunction(_mcpParams[F_GET_CLOSEST_UNIT], 8, x, y, radius, player, alignment, unitType, checkUnitEnabled, minDist);
-	return retVal;
+
+	QueryKey key(F_GET_CLOSEST_UNIT, 8);
+	key.args[0] = x;
+	key.args[1] = y;
+	key.args[2] = radius;
+	key.args[3] = player;
+	key.args[4] = alignment;
+	key.args[5] = unitType;
+	key.args[6] = checkUnitEnabled;
+	key.args[7] = minDist;
+	return cachedQuery(key);
 }
 
 int AI::getDistance(int originX, int originY, int endX, int endY) {
-	int retVal = _vm->_moonbase->callScummFunction(_mcpParams[F_GET_WORLD_DIST], 4, originX, originY, endX, endY);
-	return retVal;
+	QueryKey key(F_GET_WORLD_DIST, 4);
+	key.args[0] = originX;
+	key.args[1] = originY;
+	key.args[2] = endX;
+	key.args[3] = endY;
+	return cachedQuery(key);
 }
 
 int AI::calcAngle(int originX, int originY, int endX, int endY) {
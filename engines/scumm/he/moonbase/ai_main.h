@@ -24,6 +24,7 @@
 #define SCUMM_HE_MOONBASE_AI_MAIN_H
 
 #include "common/array.h"
+#include "common/hashmap.h"
 #include "scumm/he/moonbase/ai_tree.h"
 
 namespace Scumm {
@@ -189,6 +190,44 @@ private:
 	int energyPoolSize(int pool);
 	int getMaxCollectors(int pool);
 
+	/**
+	 * Arguments of a query to the game scripts, used as key of the query
+	 * result cache.
+	 */
+	struct QueryKey {
+		int32 func;
+		int32 numArgs;
+		int32 args[8];
+
+		QueryKey(int32 f, int32 n) : func(f), numArgs(n) { memset(args, 0, sizeof(args)); }
+	};
+
+	struct QueryKey_Hash {
+		uint operator()(const QueryKey &key) const {
+			uint hash = key.func * 31 + key.numArgs;
+			for (int i = 0; i < key.numArgs; ++i)
+				hash = hash * 31 + key.args[i];
+			return hash;
+		}
+	};
+
+	struct QueryKey_EqualTo {
+		bool operator()(const QueryKey &a, const QueryKey &b) const {
+			return a.func == b.func && a.numArgs == b.numArgs && !memcmp(a.args, b.args, a.numArgs * sizeof(a.args[0]));
+		}
+	};
+
+	typedef Common::HashMap<QueryKey, int, QueryKey_Hash, QueryKey_EqualTo> QueryCache;
+
+	/**
+	 * Results of getClosestUnit and getDistance queries. These are pure
+	 * functions of the game state, which does not change while
+	 * masterControlProgram runs, so the cache is cleared on every call.
+	 */
+	QueryCache _queryCache;
+
+	int cachedQuery(const QueryKey &key);
+
 public:
 	Common::Array<int> _lastXCoord[5];
 	Common::Array<int> _lastYCoord[5];
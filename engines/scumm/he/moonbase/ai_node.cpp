@@ -20,10 +20,15 @@
  *
  */
 
+#include "common/memorypool.h"
+
 #include "scumm/he/moonbase/ai_node.h"
 
 namespace Scumm {
 
+static Common::MemoryPool *s_nodePool = NULL;
+static int s_numPooledNodes = 0;
+
 IContainedObject::IContainedObject(IContainedObject &sourceContainedObject) {
 	_objID = sourceContainedObject.getObjID();
 	_valueG = sourceContainedObject.getG();
@@ -56,6 +61,30 @@ Node::~Node() {
 	_nodeCount--;
 }
 
+void *Node::operator new(size_t size) {
+	assert(size == sizeof(Node));
+
+	if (!s_nodePool)
+		s_nodePool = new Common::MemoryPool(sizeof(Node));
+
+	s_numPooledNodes++;
+	return s_nodePool->allocChunk();
+}
+
+void Node::operator delete(void *ptr) {
+	if (!ptr)
+		return;
+
+	assert(s_nodePool);
+	s_nodePool->freeChunk(ptr);
+
+	// Release the memory once the last search tree is gone
+	if (--s_numPooledNodes == 0) {
+		delete s_nodePool;
+		s_nodePool = NULL;
+	}
+}
+
 int Node::generateChildren() {
 	int numChildren = _contents->numChildrenToGen();
 
@@ -77,6 +77,11 @@ public:
 	Node(Node *sourceNode);
 	~Node();
 
+	// Searches create and destroy nodes in large numbers, so they are
+	// allocated from a shared pool
+	static void *operator new(size_t size);
+	static void operator delete(void *ptr);
+
 	void setParent(Node *parentPtr) { _parent = parentPtr; }
 	Node *getParent() const { return _parent; }
 
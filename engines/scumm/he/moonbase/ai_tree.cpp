@@ -28,13 +28,48 @@
 
 namespace Scumm {
 
-static int compareTreeNodes(const void *a, const void *b) {
-	if (((const TreeNode *)a)->value < ((const TreeNode *)b)->value)
-		return -1;
-	else if (((const TreeNode *)a)->value > ((const TreeNode *)b)->value)
-		return 1;
-	else
-		return 0;
+void OpenSet::push(float value, Node *node) {
+	// Sift the new entry up from the bottom of the heap
+	uint pos = _heap.size();
+	const TreeNode entry(value, _nextSequence++, node);
+	_heap.push_back(entry);
+
+	while (pos > 0) {
+		const uint parent = (pos - 1) / 2;
+		if (!isBefore(entry, _heap[parent]))
+			break;
+		_heap[pos] = _heap[parent];
+		pos = parent;
+	}
+	_heap[pos] = entry;
+}
+
+Node *OpenSet::pop() {
+	assert(!_heap.empty());
+
+	Node *result = _heap[0].node;
+	const TreeNode last = _heap.back();
+	_heap.pop_back();
+
+	if (!_heap.empty()) {
+		// Sift the last entry down from the top of the heap
+		const uint size = _heap.size();
+		uint pos = 0;
+		for (;;) {
+			uint child = pos * 2 + 1;
+			if (child >= size)
+				break;
+			if (child + 1 < size && isBefore(_heap[child + 1], _heap[child]))
+				++child;
+			if (!isBefore(_heap[child], last))
+				break;
+			_heap[pos] = _heap[child];
+			pos = child;
+		}
+		_heap[pos] = last;
+	}
+
+	return result;
 }
 
 Tree::Tree(AI *ai) : _ai(ai) {
@@ -43,8 +78,6 @@ Tree::Tree(AI *ai) : _ai(ai) {
 	_maxNodes = MAX_NODES;
 	_currentNode = 0;
 	_currentChildIndex = 0;
-
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
 }
 
 Tree::Tree(IContainedObject *contents, AI *ai) : _ai(ai) {
@@ -54,8 +87,6 @@ Tree::Tree(IContainedObject *contents, AI *ai) : _ai(ai) {
 	_maxNodes = MAX_NODES;
 	_currentNode = 0;
 	_currentChildIndex = 0;
-
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
 }
 
 Tree::Tree(IContainedObject *contents, int maxDepth, AI *ai) : _ai(ai) {
@@ -65,8 +96,6 @@ Tree::Tree(IContainedObject *contents, int maxDepth, AI *ai) : _ai(ai) {
 	_maxNodes = MAX_NODES;
 	_currentNode = 0;
 	_currentChildIndex = 0;
-
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
 }
 
 Tree::Tree(IContainedObject *contents, int maxDepth, int maxNodes, AI *ai) : _ai(ai) {
@@ -76,8 +105,6 @@ Tree::Tree(IContainedObject *contents, int maxDepth, int maxNodes, AI *ai) : _ai
 	_maxNodes = maxNodes;
 	_currentNode = 0;
 	_currentChildIndex = 0;
-
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
 }
 
 void Tree::duplicateTree(Node *sourceNode, Node *destNode) {
@@ -96,7 +123,6 @@ Tree::Tree(const Tree *sourceTree, AI *ai) : _ai(ai) {
 	pBaseNode = new Node(sourceTree->getBaseNode());
 	_maxDepth = sourceTree->getMaxDepth();
 	_maxNodes = sourceTree->getMaxNodes();
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
 	_currentNode = 0;
 	_currentChildIndex = 0;
 
@@ -120,12 +146,10 @@ Tree::~Tree() {
 			pTemp = NULL;
 		}
 	}
-
-	delete _currentMap;
 }
 
 Node *Tree::aStarSearch() {
-	Common::SortedArray<TreeNode *> mmfpOpen(compareTreeNodes);
+	OpenSet mmfpOpen;
 
 	Node *currentNode = NULL;
 	float currentT;
@@ -135,11 +159,10 @@ Node *Tree::aStarSearch() {
 	float temp = pBaseNode->getContainedObject()->calcT();
 
 	if (static_cast<int>(temp) != SUCCESS) {
-		mmfpOpen.insert(new TreeNode(pBaseNode->getObjectT(), pBaseNode));
+		mmfpOpen.push(pBaseNode->getObjectT(), pBaseNode);
 
 		while (mmfpOpen.size() && (retNode == NULL)) {
-			currentNode = mmfpOpen.front()->node;
-			mmfpOpen.erase(mmfpOpen.begin());
+			currentNode = mmfpOpen.pop();
 
 			if ((currentNode->getDepth() < _maxDepth) && (Node::getNodeCount() < _maxNodes)) {
 				// Generate nodes
@@ -152,7 +175,7 @@ Node *Tree::aStarSearch() {
 					if (currentT == SUCCESS)
 						retNode = *i;
 					else
-						mmfpOpen.insert(new TreeNode(currentT, (*i)));
+						mmfpOpen.push(currentT, *i);
 				}
 			} else {
 				retNode = currentNode;
@@ -174,7 +197,7 @@ Node *Tree::aStarSearch_singlePassInit() {
 	float temp = pBaseNode->getContainedObject()->calcT();
 
 	if (static_cast<int>(temp) != SUCCESS) {
-		_currentMap->insert(new TreeNode(pBaseNode->getObjectT(), pBaseNode));
+		_openSet.push(pBaseNode->getObjectT(), pBaseNode);
 	} else {
 		retNode = pBaseNode;
 	}
@@ -193,13 +216,12 @@ Node *Tree::aStarSearch_singlePass() {
 	}
 
 	if (_currentChildIndex) {
-		if (!(_currentMap->size())) {
+		if (_openSet.empty()) {
 			retNode = _currentNode;
 			return retNode;
 		}
 
-		_currentNode = _currentMap->front()->node;
-		_currentMap->erase(_currentMap->begin());
+		_currentNode = _openSet.pop();
 	}
 
 	if ((_currentNode->getDepth() < _maxDepth) && (Node::getNodeCount() < _maxNodes) && ((!maxTime) || (_ai->getTimerValue(3) < maxTime))) {
@@ -209,7 +231,7 @@ Node *Tree::aStarSearch_singlePass() {
 		if (_currentChildIndex) {
 			Common::Array<Node *> vChildren = _currentNode->getChildren();
 
-			if (!vChildren.size() && !_currentMap->size()) {
+			if (!vChildren.size() && _openSet.empty()) {
 				_currentChildIndex = 0;
 				retNode = _currentNode;
 			}
@@ -222,11 +244,11 @@ Node *Tree::aStarSearch_singlePass() {
 					retNode = *i;
 					i = vChildren.end() - 1;
 				} else {
-					_currentMap->insert(new TreeNode(currentT, (*i)));
+					_openSet.push(currentT, *i);
 				}
 			}
 
-			if (!(_currentMap->size()) && (currentT != SUCCESS)) {
+			if (_openSet.empty() && (currentT != SUCCESS)) {
 				assert(_currentNode != NULL);
 				retNode = _currentNode;
 			}
@@ -35,9 +35,34 @@ class AI;
 
 struct TreeNode {
 	float value;
+	uint32 sequence;
 	Node *node;
 
-	TreeNode(float v, Node *n) { value = v; node = n; }
+	TreeNode(float v, uint32 s, Node *n) { value = v; sequence = s; node = n; }
+};
+
+/**
+ * The open set of an A* search: a binary min-heap of nodes, ordered by
+ * their T value. Nodes with equal values are returned in the order they
+ * were added, so searches are deterministic.
+ */
+class OpenSet {
+private:
+	Common::Array<TreeNode> _heap;
+	uint32 _nextSequence;
+
+	static bool isBefore(const TreeNode &a, const TreeNode &b) {
+		return a.value < b.value || (a.value == b.value && a.sequence < b.sequence);
+	}
+
+public:
+	OpenSet() : _nextSequence(0) {}
+
+	bool empty() const { return _heap.empty(); }
+	uint size() const { return _heap.size(); }
+
+	void push(float value, Node *node);
+	Node *pop();
 };
 
 class Tree {
@@ -49,7 +74,7 @@ private:
 
 	int _currentChildIndex;
 
-	Common::SortedArray<TreeNode *> *_currentMap;
+	OpenSet _openSet;
 	Node *_currentNode;
 
 	AI *_ai;
@@ -148,6 +148,16 @@ void Moonbase::blitT14WizImage(uint8 *dst, int dstw, int dsth, int dstPitch, con
 					src = quadsOffset;
 					quadsOffset += 8;
 					cnt = 4; // 4 pixels
+
+					// Copy quads which are fully visible in one go
+					if (rawROP == 1 && pixels >= sx && pixels + 4 <= cx + sx) {
+						memcpy(dst1, src, 8);
+						dst1 += 8;
+						pixels += 4;
+						if (pixels >= cx + sx)
+							break;
+						continue;
+					}
 				} else { // single
 					src = singlesOffset;
 					singlesOffset += 2;
@@ -182,13 +192,13 @@ void Moonbase::blitT14WizImage(uint8 *dst, int dstw, int dsth, int dstPitch, con
 				if ((code & 1) == 0) {
 					code >>= 1;
 
-					for (int j = 0; j < code; j++) {
-						if (pixels >= sx)
-							dst1 += 2;
-						pixels++;
-						if (pixels >= cx + sx)
-							break;
-					}
+					// Skip the transparent pixels, stopping at the end of
+					// the clipped line
+					const int count = MIN(code, cx + sx - pixels);
+					const int visible = pixels + count - MAX(pixels, sx);
+					if (visible > 0)
+						dst1 += visible * 2;
+					pixels += count;
 				} else { // special case
 					if (pixels >= sx) {
 						int alpha = code >> 1;
@@ -22,6 +22,9 @@
 
 #ifdef ENABLE_HE
 
+#include "common/algorithm.h"
+#include "common/system.h"
+
 #include "scumm/he/intern_he.h"
 #include "scumm/resource.h"
 #include "scumm/scumm.h"
@@ -41,13 +44,21 @@ Sprite::Sprite(ScummEngine_v90he *vm)
 	_numSpritesToProcess(0),
 	_varNumSpriteGroups(0),
 	_varNumSprites(0),
-	_varMaxSprites(0) {
+	_varMaxSprites(0),
+	_activeSpritesChanged(true),
+	_groupNeedsRedraw(0),
+	_groupRedrawPending(false),
+	_frameStartTime(0),
+	_curFrameTime(0),
+	_curRedrawnSprites(0) {
+	resetFrameStats();
 }
 
 Sprite::~Sprite() {
 	free(_spriteGroups);
 	free(_spriteTable);
 	free(_activeSpritesTable);
+	free(_groupNeedsRedraw);
 }
 
 void ScummEngine_v90he::allocateArrays() {
@@ -552,6 +563,9 @@ void Sprite::setSpriteGroup(int spriteId, int value) {
 	assertRange(1, spriteId, _varNumSprites, "sprite");
 	assertRange(0, value, _varNumSpriteGroups, "sprite group");
 
+	if (_spriteTable[spriteId].group != value)
+		_activeSpritesChanged = true;
+
 	_spriteTable[spriteId].group = value;
 	_spriteTable[spriteId].flags |= kSFChanged | kSFNeedRedraw;
 }
@@ -580,6 +594,9 @@ void Sprite::setSpriteUserValue(int spriteId, int value1, int value2) {
 void Sprite::setSpritePriority(int spriteId, int value) {
 	assertRange(1, spriteId, _varNumSprites, "sprite");
 
+	if (_spriteTable[spriteId].priority != value)
+		_activeSpritesChanged = true;
+
 	_spriteTable[spriteId].priority = value;
 }
 
@@ -661,10 +678,14 @@ void Sprite::setSpriteFlagXFlipped(int spriteId, int value) {
 void Sprite::setSpriteFlagActive(int spriteId, int value) {
 	assertRange(1, spriteId, _varNumSprites, "sprite");
 
+	int oldFlags = _spriteTable[spriteId].flags;
 	if (value)
 		_spriteTable[spriteId].flags |= kSFActive;
 	else
 		_spriteTable[spriteId].flags &= ~kSFActive;
+
+	if ((_spriteTable[spriteId].flags ^ oldFlags) & kSFActive)
+		_activeSpritesChanged = true;
 }
 
 void Sprite::setSpriteFlagRemapPalette(int spriteId, int value) {
@@ -781,6 +802,9 @@ void Sprite::resetSprite(int spriteId) {
 
 	setSpriteImage(spriteId, 0);
 
+	if (_spriteTable[spriteId].group || _spriteTable[spriteId].priority)
+		_activeSpritesChanged = true;
+
 	_spriteTable[spriteId].shadow = 0;
 	_spriteTable[spriteId].tx = 0;
 	_spriteTable[spriteId].ty = 0;
@@ -815,6 +839,7 @@ void Sprite::setSpriteImage(int spriteId, int imageNum) {
 
 	origResId = _spriteTable[spriteId].image;
 	origResWizStates = _spriteTable[spriteId].imageStateCount;
+	int origFlags = _spriteTable[spriteId].flags;
 
 	_spriteTable[spriteId].image = imageNum;
 	_spriteTable[spriteId].animIndex = 0;
@@ -843,18 +868,35 @@ void Sprite::setSpriteImage(int spriteId, int imageNum) {
 		_spriteTable[spriteId].curImageState = 0;
 		_spriteTable[spriteId].imageStateCount = 0;
 	}
+
+	if ((_spriteTable[spriteId].flags ^ origFlags) & kSFActive)
+		_activeSpritesChanged = true;
 }
 
 //
 // spriteGroupSet functions
 //
 void Sprite::redrawSpriteGroup(int spriteGroupId) {
+	// Scripts often change several properties of a group in a row, so
+	// only note the group here and mark its sprites in a single pass over
+	// the active sprites before their flags are looked at again.
+	_groupNeedsRedraw[spriteGroupId] = 1;
+	_groupRedrawPending = true;
+}
+
+void Sprite::flushGroupRedraws() {
+	if (!_groupRedrawPending)
+		return;
+
 	for (int i = 0; i < _numSpritesToProcess; ++i) {
 		SpriteInfo *spi = _activeSpritesTable[i];
-		if (spi->group == spriteGroupId) {
+		if (spi->group >= 0 && spi->group <= _varNumSpriteGroups && _groupNeedsRedraw[spi->group]) {
 			spi->flags |= kSFChanged | kSFNeedRedraw;
 		}
 	}
+
+	memset(_groupNeedsRedraw, 0, _varNumSpriteGroups + 1);
+	_groupRedrawPending = false;
 }
 
 void Sprite::moveGroupMembers(int spriteGroupId, int value1, int value2) {
@@ -875,8 +917,10 @@ void Sprite::setGroupMembersPriority(int spriteGroupId, int value) {
 	assertRange(1, spriteGroupId, _varNumSpriteGroups, "sprite group");
 
 	for (int i = 1; i < _varNumSprites; i++) {
-		if (_spriteTable[i].group == spriteGroupId)
+		if (_spriteTable[i].group == spriteGroupId && _spriteTable[i].priority != value) {
 			_spriteTable[i].priority = value;
+			_activeSpritesChanged = true;
+		}
 	}
 }
 
@@ -887,6 +931,7 @@ void Sprite::setGroupMembersGroup(int spriteGroupId, int value) {
 		if (_spriteTable[i].group == spriteGroupId) {
 			_spriteTable[i].group = value;
 			_spriteTable[i].flags |= kSFChanged | kSFNeedRedraw;
+			_activeSpritesChanged = true;
 		}
 	}
 }
@@ -963,6 +1008,7 @@ void Sprite::setGroupPriority(int spriteGroupId, int value) {
 
 	if (_spriteGroups[spriteGroupId].priority != value) {
 		_spriteGroups[spriteGroupId].priority = value;
+		_activeSpritesChanged = true;
 		redrawSpriteGroup(spriteGroupId);
 	}
 }
@@ -1065,12 +1111,17 @@ void Sprite::allocTables(int numSprites, int numGroups, int numMaxSprites) {
 	_spriteGroups = (SpriteGroup *)malloc((_varNumSpriteGroups + 1) * sizeof(SpriteGroup));
 	_spriteTable = (SpriteInfo *)malloc((_varNumSprites + 1) * sizeof(SpriteInfo));
 	_activeSpritesTable = (SpriteInfo **)malloc((_varNumSprites + 1) * sizeof(SpriteInfo *));
+	_groupNeedsRedraw = (byte *)calloc(_varNumSpriteGroups + 1, 1);
+	_groupRedrawPending = false;
+	_activeSpritesChanged = true;
 }
 
 void Sprite::resetGroup(int spriteGroupId) {
 	assertRange(1, spriteGroupId, _varNumSpriteGroups, "sprite group");
 	SpriteGroup *spg = &_spriteGroups[spriteGroupId];
 
+	if (spg->priority)
+		_activeSpritesChanged = true;
 	spg->priority = 0;
 	spg->tx = spg->ty = 0;
 
@@ -1099,7 +1150,9 @@ void Sprite::resetTables(bool refreshScreen) {
 	if (refreshScreen) {
 		_vm->restoreBackgroundHE(Common::Rect(_vm->_screenWidth, _vm->_screenHeight));
 	}
+	flushGroupRedraws();
 	_numSpritesToProcess = 0;
+	_activeSpritesChanged = true;
 }
 
 void Sprite::resetBackground() {
@@ -1109,6 +1162,8 @@ void Sprite::resetBackground() {
 	bool firstLoop = true;
 	bool refreshScreen = false;
 
+	flushGroupRedraws();
+
 	for (int i = 0; i < _numSpritesToProcess; ++i) {
 		SpriteInfo *spi = _activeSpritesTable[i];
 		if (!(spi->flags & kSFImageless) && (spi->flags & kSFChanged)) {
@@ -1150,6 +1205,7 @@ void Sprite::resetBackground() {
 
 void Sprite::setRedrawFlags(bool checkZOrder) {
 	VirtScreen *vs = &_vm->_virtscr[kMainVirtScreen];
+	flushGroupRedraws();
 	for (int i = 0; i < _numSpritesToProcess; ++i) {
 		SpriteInfo *spi = _activeSpritesTable[i];
 		if (!(spi->flags & kSFNeedRedraw)) {
@@ -1203,26 +1259,48 @@ void Sprite::updateImages() {
 	}
 }
 
-static int compareSprTable(const void *a, const void *b) {
-	const SpriteInfo *spr1 = *(const SpriteInfo *const*)a;
-	const SpriteInfo *spr2 = *(const SpriteInfo *const*)b;
-
-	if (spr1->zorder > spr2->zorder)
-		return 1;
+// Sprites with the same zorder are drawn in the order of their ids
+static bool compareSprTable(const SpriteInfo *spr1, const SpriteInfo *spr2) {
+	if (spr1->zorder != spr2->zorder)
+		return spr1->zorder < spr2->zorder;
 
-	if (spr1->zorder < spr2->zorder)
-		return -1;
-
-	return 0;
+	return spr1->id < spr2->id;
 }
 
 void Sprite::sortActiveSprites() {
 	int groupZorder;
 
+	finishFrameStats();
+	_frameStartTime = g_system->getMillis();
+
+	flushGroupRedraws();
+
+	// The sorted list stays valid until a sprite is (de)activated or its
+	// zorder changes; in all other frames only the redraw flags of the
+	// sprites that are not tracked by the dirty rects need updating.
+	if (!_activeSpritesChanged) {
+		for (int i = 0; i < _numSpritesToProcess; i++) {
+			SpriteInfo *spi = _activeSpritesTable[i];
+
+			if (!(spi->flags & kSFMarkDirty)) {
+				spi->flags |= kSFNeedRedraw;
+				if (!(spi->flags & kSFImageless))
+					spi->flags |= kSFChanged;
+			}
+		}
+		_frameStats.activeSprites = _numSpritesToProcess;
+		_curFrameTime += g_system->getMillis() - _frameStartTime;
+		return;
+	}
+
 	_numSpritesToProcess = 0;
+	_activeSpritesChanged = false;
+	_frameStats.listRebuilds++;
 
-	if (_varNumSprites <= 1)
+	if (_varNumSprites <= 1) {
+		_frameStats.activeSprites = 0;
 		return;
+	}
 
 	for (int i = 1; i < _varNumSprites; i++) {
 		SpriteInfo *spi = &_spriteTable[i];
@@ -1245,10 +1323,33 @@ void Sprite::sortActiveSprites() {
 		}
 	}
 
-	if (_numSpritesToProcess < 2)
+	_frameStats.activeSprites = _numSpritesToProcess;
+
+	if (_numSpritesToProcess >= 2)
+		Common::sort(_activeSpritesTable, _activeSpritesTable + _numSpritesToProcess, compareSprTable);
+
+	_curFrameTime += g_system->getMillis() - _frameStartTime;
+}
+
+void Sprite::finishFrameStats() {
+	if (!_frameStartTime)
 		return;
 
-	qsort(_activeSpritesTable, _numSpritesToProcess, sizeof(SpriteInfo *), compareSprTable);
+	_frameStats.frames++;
+	_frameStats.redrawnSprites = _curRedrawnSprites;
+	_frameStats.lastFrameTime = _curFrameTime;
+	_frameStats.maxFrameTime = MAX(_frameStats.maxFrameTime, _curFrameTime);
+	_frameStats.totalTime += _curFrameTime;
+
+	_curFrameTime = 0;
+	_curRedrawnSprites = 0;
+}
+
+void Sprite::resetFrameStats() {
+	memset(&_frameStats, 0, sizeof(_frameStats));
+	_frameStartTime = 0;
+	_curFrameTime = 0;
+	_curRedrawnSprites = 0;
 }
 
 void Sprite::processImages(bool arg) {
@@ -1260,6 +1361,9 @@ void Sprite::processImages(bool arg) {
 	int32 w, h;
 	WizParameters wiz;
 
+	const uint32 startTime = g_system->getMillis();
+	flushGroupRedraws();
+
 	for (int i = 0; i < _numSpritesToProcess; i++) {
 		SpriteInfo *spi = _activeSpritesTable[i];
 
@@ -1270,13 +1374,14 @@ void Sprite::processImages(bool arg) {
 
 		if (arg) {
 			if (spi->zorder >= 0)
-				return;
+				break;
 		} else {
 			if (spi->zorder < 0)
 				continue;
 		}
 
 		spi->flags &= ~kSFNeedRedraw;
+		_curRedrawnSprites++;
 		image = spi->image;
 		imageState = spi->imageState;
 		_vm->_wiz->getWizImageSpot(spi->image, spi->imageState, spr_wiz_x, spr_wiz_y);
@@ -1391,6 +1496,8 @@ void Sprite::processImages(bool arg) {
 		}
 		_vm->_wiz->displayWizComplexImage(&wiz);
 	}
+
+	_curFrameTime += g_system->getMillis() - startTime;
 }
 
 static void syncWithSerializer(Common::Serializer &s, SpriteInfo &si) {
@@ -1452,6 +1559,9 @@ static void syncWithSerializer(Common::Serializer &s, SpriteGroup &sg) {
 }
 
 void Sprite::saveLoadWithSerializer(Common::Serializer &s) {
+	if (s.isSaving())
+		flushGroupRedraws();
+
 	if (s.getVersion() >= VER(64)) {
 		s.syncArray(_spriteTable, _varNumSprites + 1, syncWithSerializer);
 		s.syncArray(_spriteGroups, _varNumSpriteGroups + 1, syncWithSerializer);
@@ -1464,8 +1574,12 @@ void Sprite::saveLoadWithSerializer(Common::Serializer &s) {
 	}
 
 	// Reset active sprite table
-	if (s.isLoading())
+	if (s.isLoading()) {
 		_numSpritesToProcess = 0;
+		_activeSpritesChanged = true;
+		memset(_groupNeedsRedraw, 0, _varNumSpriteGroups + 1);
+		_groupRedrawPending = false;
+	}
 }
 
 } // End of namespace Scumm
@@ -165,6 +165,23 @@ public:
 	int32 _varNumSprites;
 	int32 _varMaxSprites;
 
+	/**
+	 * Per-frame sprite processing statistics, reported by the "sprites"
+	 * debugger command. Times are in milliseconds.
+	 */
+	struct FrameStats {
+		uint32 frames;
+		uint32 listRebuilds;     ///< Frames in which the sorted active sprite list had to be rebuilt
+		uint32 activeSprites;    ///< Active sprites in the last frame
+		uint32 redrawnSprites;   ///< Sprites redrawn in the last frame
+		uint32 lastFrameTime;
+		uint32 maxFrameTime;
+		uint32 totalTime;
+	};
+
+	const FrameStats &getFrameStats() const { return _frameStats; }
+	void resetFrameStats();
+
 	void saveLoadWithSerializer(Common::Serializer &s);
 	void resetBackground();
 	void setRedrawFlags(bool checkZOrder);
@@ -266,6 +283,24 @@ public:
 	void setSpriteImage(int spriteId, int imageNum);
 private:
 	ScummEngine_v90he *_vm;
+
+	/**
+	 * Set when the set of active sprites or their zorder may have changed,
+	 * so sortActiveSprites() has to rebuild _activeSpritesTable.
+	 */
+	bool _activeSpritesChanged;
+
+	/** Groups whose sprites have to be redrawn, see flushGroupRedraws(). */
+	byte *_groupNeedsRedraw;
+	bool _groupRedrawPending;
+
+	FrameStats _frameStats;
+	uint32 _frameStartTime;
+	uint32 _curFrameTime;
+	uint32 _curRedrawnSprites;
+
+	void flushGroupRedraws();
+	void finishFrameStats();
 };
 
 } // End of namespace Scumm
@@ -371,6 +371,28 @@ void Wiz::writeColor(uint8 *dstPtr, int dstType, uint16 color) {
 }
 
 #ifdef USE_RGB_COLOR
+/**
+ * Returns whether 16 bit colors are stored in little endian byte order in
+ * destinations of the given type, i.e. whether pixels can be copied as is
+ * from the Wiz data.
+ */
+static bool isLittleEndianDst(int dstType) {
+	switch (dstType) {
+	case kDstMemory:
+	case kDstResource:
+		return true;
+	case kDstCursor:
+	case kDstScreen:
+#ifdef SCUMM_LITTLE_ENDIAN
+		return true;
+#else
+		return false;
+#endif
+	default:
+		return false;
+	}
+}
+
 void Wiz::copy16BitWizImage(uint8 *dst, const uint8 *src, int dstPitch, int dstType, int dstw, int dsth, int srcx, int srcy, int srcw, int srch, const Common::Rect *rect, int flags, const uint8 *xmapPtr) {
 	Common::Rect r1, r2;
 	if (calcClipRects(dstw, dsth, srcx, srcy, srcw, srch, rect, r1, r2)) {
@@ -646,6 +668,14 @@ void Wiz::copyRaw16BitWizImage(uint8 *dst, const uint8 *src, int dstPitch, int d
 		int w = r1.width();
 		src += (r1.top * srcw + r1.left) * 2;
 		dst += r2.top * dstPitch + r2.left * 2;
+		if (transColor == -1 && isLittleEndianDst(dstType)) {
+			while (h--) {
+				memcpy(dst, src, w * 2);
+				src += srcw * 2;
+				dst += dstPitch;
+			}
+			return;
+		}
 		while (h--) {
 			for (int i = 0; i < w; ++ i) {
 				uint16 col = READ_LE_UINT16(src + 2 * i);
@@ -687,6 +717,22 @@ void Wiz::copyRawWizImage(uint8 *dst, const uint8 *src, int dstPitch, int dstTyp
 	}
 }
 
+/**
+ * Writes a run of 'count' pixels of the same 16 bit color and advances
+ * dstPtr past it.
+ */
+static void fill16BitRun(uint8 *&dstPtr, int dstInc, int dstType, uint16 color, int count) {
+	// Let writeColor convert the color to the byte order of the destination
+	// once, then replicate the result
+	Wiz::writeColor(dstPtr, dstType, color);
+	const uint16 raw = READ_UINT16(dstPtr);
+	dstPtr += dstInc;
+	while (--count > 0) {
+		WRITE_UINT16(dstPtr, raw);
+		dstPtr += dstInc;
+	}
+}
+
 #ifdef USE_RGB_COLOR
 template<int type>
 void Wiz::write16BitColor(uint8 *dstPtr, const uint8 *dataPtr, int dstType, const uint8 *xmapPtr) {
@@ -771,9 +817,13 @@ void Wiz::decompress16BitWizImage(uint8 *dst, int dstPitch, int dstType, const u
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
-						dstPtr += dstInc;
+					if (type == kWizCopy) {
+						fill16BitRun(dstPtr, dstInc, dstType, READ_LE_UINT16(dataPtr), code);
+					} else {
+						while (code--) {
+							write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
+							dstPtr += dstInc;
+						}
 					}
 					dataPtr += 2;
 				} else {
@@ -791,10 +841,16 @@ void Wiz::decompress16BitWizImage(uint8 *dst, int dstPitch, int dstType, const u
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
-						dataPtr += 2;
-						dstPtr += dstInc;
+					if (type == kWizCopy && dstInc > 0 && isLittleEndianDst(dstType)) {
+						memcpy(dstPtr, dataPtr, code * 2);
+						dataPtr += code * 2;
+						dstPtr += code * 2;
+					} else {
+						while (code--) {
+							write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
+							dataPtr += 2;
+							dstPtr += dstInc;
+						}
 					}
 				}
 			}
@@ -905,9 +961,24 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dstPtr += dstInc;
+					if (type != kWizXMap && bitDepth == 1) {
+						// The same color is written to every pixel of the run
+						const uint8 color = (type == kWizRMap) ? palPtr[*dataPtr] : *dataPtr;
+						if (dstInc > 0) {
+							memset(dstPtr, color, code);
+							dstPtr += code;
+						} else {
+							memset(dstPtr - code + 1, color, code);
+							dstPtr -= code;
+						}
+					} else if (type != kWizXMap) {
+						const uint16 color = (type == kWizRMap) ? READ_LE_UINT16(palPtr + *dataPtr * 2) : *dataPtr;
+						fill16BitRun(dstPtr, dstInc, dstType, color, code);
+					} else {
+						while (code--) {
+							write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
+							dstPtr += dstInc;
+						}
 					}
 					dataPtr++;
 				} else {
@@ -925,10 +996,16 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dataPtr++;
-						dstPtr += dstInc;
+					if (type == kWizCopy && bitDepth == 1 && dstInc > 0) {
+						memcpy(dstPtr, dataPtr, code);
+						dataPtr += code;
+						dstPtr += code;
+					} else {
+						while (code--) {
+							write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
+							dataPtr++;
+							dstPtr += dstInc;
+						}
 					}
 				}
 			}
@@ -952,6 +1029,14 @@ void Wiz::decompressRawWizImage(uint8 *dst, int dstPitch, int dstType, const uin
 	if (w <= 0 || h <= 0) {
 		return;
 	}
+	if (type == kWizCopy && bitDepth == 1 && transColor == -1) {
+		while (h--) {
+			memcpy(dst, src, w);
+			src += srcPitch;
+			dst += dstPitch;
+		}
+		return;
+	}
 	while (h--) {
 		for (int i = 0; i < w; ++i) {
 			uint8 col = src[i];
@@ -2163,26 +2248,50 @@ void Wiz::drawWizPolygonImage(uint8 *dst, const uint8 *src, const uint8 *mask, i
 		++y_start;
 	}
 
+	const int32 srcSize = wizW * wizH;
 	pra = &pdd.ra[0];
 	for (i = 0; i < pdd.rAreasNum; ++i, ++pra) {
 		uint8 *dstPtr = dst + pra->dst_offs;
 		int32 w = pra->w;
 		int32 x_acc = pra->x_s;
 		int32 y_acc = pra->y_s;
-		while (--w) {
-			int32 src_offs = (y_acc / (1 << 16)) * wizW + (x_acc / (1 << 16));
-			assert(src_offs < wizW * wizH);
-			x_acc += pra->x_step;
-			y_acc += pra->y_step;
-			if (bitDepth == 2) {
-				if (transColor == -1 || transColor != READ_LE_UINT16(src + src_offs * 2)) {
-					writeColor(dstPtr, dstType, READ_LE_UINT16(src + src_offs * 2));
-				}
-			} else {
-				if (transColor == -1 || transColor != src[src_offs])
-					*dstPtr = src[src_offs];
+		const int32 x_step = pra->x_step;
+		const int32 y_step = pra->y_step;
+
+		// Check the offsets of the first and last pixel of the span up
+		// front. The source coordinates change monotonically along the span,
+		// so all the pixels in between are within the image, too.
+		if (w > 1) {
+			const int32 lastX = x_acc + x_step * (w - 2);
+			const int32 lastY = y_acc + y_step * (w - 2);
+			assert((y_acc / (1 << 16)) * wizW + (x_acc / (1 << 16)) < srcSize);
+			assert((lastY / (1 << 16)) * wizW + (lastX / (1 << 16)) < srcSize);
+		}
+
+		if (bitDepth == 2) {
+			while (--w) {
+				const uint16 color = READ_LE_UINT16(src + ((y_acc / (1 << 16)) * wizW + (x_acc / (1 << 16))) * 2);
+				x_acc += x_step;
+				y_acc += y_step;
+				if (transColor == -1 || transColor != color)
+					writeColor(dstPtr, dstType, color);
+				dstPtr += 2;
+			}
+		} else if (transColor == -1) {
+			while (--w) {
+				*dstPtr++ = src[(y_acc / (1 << 16)) * wizW + (x_acc / (1 << 16))];
+				x_acc += x_step;
+				y_acc += y_step;
+			}
+		} else {
+			while (--w) {
+				const uint8 color = src[(y_acc / (1 << 16)) * wizW + (x_acc / (1 << 16))];
+				x_acc += x_step;
+				y_acc += y_step;
+				if (transColor != color)
+					*dstPtr = color;
+				dstPtr++;
 			}
-			dstPtr += bitDepth;
 		}
 	}
 
@@ -2924,6 +3033,109 @@ int ScummEngine_v90he::computeWizHistogram(int resNum, int state, int x, int y,
 	return readVar(0);
 }
 
+#pragma mark -
+#pragma mark --- Benchmark ---
+#pragma mark -
+
+/**
+ * Builds the data of a synthetic RLE compressed Wiz image, made of
+ * transparent, filled and literal runs in about equal parts, like typical
+ * sprites. 'bytesPerPixel' selects between type 1 and type 5 data.
+ */
+static void buildBenchmarkRLEImage(Common::Array<uint8> &data, int w, int h, int bytesPerPixel) {
+	for (int y = 0; y < h; ++y) {
+		const uint32 lineStart = data.size();
+		data.push_back(0);
+		data.push_back(0);
+
+		int x = 0;
+		int run = 0;
+		while (x < w) {
+			const int n = MIN(8 + (x + y) % 24, w - x);
+			switch (run++ % 3) {
+			case 0:
+				// Transparent run
+				data.push_back((n << 1) | 1);
+				break;
+			case 1:
+				// Filled run
+				data.push_back(((n - 1) << 2) | 2);
+				for (int i = 0; i < bytesPerPixel; ++i)
+					data.push_back(x + y + i);
+				break;
+			default:
+				// Literal run
+				data.push_back((n - 1) << 2);
+				for (int i = 0; i < n * bytesPerPixel; ++i)
+					data.push_back(x + i);
+				break;
+			}
+			x += n;
+		}
+
+		const uint16 lineSize = data.size() - lineStart - 2;
+		data[lineStart] = lineSize & 0xFF;
+		data[lineStart + 1] = lineSize >> 8;
+	}
+}
+
+int32 Wiz::benchmarkDecoder(int comp, int iterations) {
+	const int w = 640, h = 480;
+	const uint8 bitDepth = (comp == 2 || comp == 5) ? 2 : 1;
+
+#ifndef USE_RGB_COLOR
+	if (bitDepth == 2)
+		return -1;
+#endif
+
+	Common::Array<uint8> data;
+	switch (comp) {
+	case 0:
+	case 2:
+		data.resize(w * h * bitDepth);
+		for (uint i = 0; i < data.size(); ++i)
+			data[i] = i % 251;
+		break;
+	case 1:
+	case 5:
+		buildBenchmarkRLEImage(data, w, h, bitDepth);
+		break;
+	default:
+		return -1;
+	}
+
+	const int dstPitch = w * bitDepth;
+	uint8 *dst = (uint8 *)calloc(h, dstPitch);
+	if (!dst)
+		return -1;
+
+	const uint32 startTime = g_system->getMillis();
+	for (int i = 0; i < iterations; ++i) {
+		switch (comp) {
+		case 0:
+			copyRawWizImage(dst, data.begin(), dstPitch, kDstMemory, w, h, 0, 0, w, h, NULL, 0, NULL, -1, bitDepth);
+			break;
+		case 1:
+			copyWizImage(dst, data.begin(), dstPitch, kDstMemory, w, h, 0, 0, w, h, NULL, 0, NULL, NULL, bitDepth);
+			break;
+#ifdef USE_RGB_COLOR
+		case 2:
+			copyRaw16BitWizImage(dst, data.begin(), dstPitch, kDstMemory, w, h, 0, 0, w, h, NULL, 0, -1);
+			break;
+		case 5:
+			copy16BitWizImage(dst, data.begin(), dstPitch, kDstMemory, w, h, 0, 0, w, h, NULL, 0, NULL);
+			break;
+#endif
+		default:
+			break;
+		}
+	}
+	const uint32 time = g_system->getMillis() - startTime;
+
+	free(dst);
+	return time;
+}
+
 } // End of namespace Scumm
 
 #endif // ENABLE_HE
@@ -332,6 +332,13 @@ public:
 	void computeWizHistogram(uint32 *histogram, const uint8 *data, const Common::Rect& rCapt);
 	void computeRawWizHistogram(uint32 *histogram, const uint8 *data, int srcPitch, const Common::Rect& rCapt);
 
+	/**
+	 * Draw a synthetic 640x480 image of the given compression type (0, 1, 2
+	 * or 5) 'iterations' times. Returns the time this took in ms, or -1 if
+	 * the compression type is not supported.
+	 */
+	static int32 benchmarkDecoder(int comp, int iterations);
+
 private:
 	ScummEngine_v71he *_vm;
 };
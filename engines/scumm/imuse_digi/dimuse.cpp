@@ -52,6 +52,7 @@ IMuseDigital::IMuseDigital(ScummEngine_v7 *scumm, Audio::Mixer *mixer, int fps)
 	assert(_sound);
 	_callbackFps = fps;
 	resetState();
+	resetStreamStats();
 	for (int l = 0; l < MAX_DIGITAL_TRACKS + MAX_DIGITAL_FADETRACKS; l++) {
 		_track[l] = new Track;
 		assert(_track[l]);
@@ -261,6 +262,13 @@ void IMuseDigital::callback() {
 
 				if (track->stream->endOfData()) {
 					feedSize *= 2;
+
+					// A fresh stream is always empty; only count tracks
+					// whose queue ran dry after playback had started.
+					if (_mixer->getSoundElapsedTime(track->mixChanHandle) > 0) {
+						_streamStats.underruns++;
+						_streamStats.lastUnderrunSoundId = track->soundId;
+					}
 				}
 
 				if ((bits == 12) || (bits == 16)) {
@@ -350,6 +358,13 @@ void IMuseDigital::callback() {
 					feedSize -= curFeedSize;
 					assert(feedSize >= 0);
 				} while (feedSize != 0);
+
+				// Decode the upcoming bundle blocks now, so crossfading tracks
+				// do not all have to decode their next block in the same callback.
+				if (track->stream && track->soundDesc) {
+					int32 readOffset = (bits == 12) ? (track->regionOffset * 3) / 4 : track->regionOffset;
+					_sound->decodeAheadOfRegion(track->soundDesc, track->curRegion, readOffset);
+				}
 			}
 			if (_mixer->isReady()) {
 				_mixer->setChannelVolume(track->mixChanHandle, track->getVol());
@@ -359,6 +374,24 @@ void IMuseDigital::callback() {
 	}
 }
 
+IMuseDigital::StreamStats IMuseDigital::getStreamStats() {
+	Common::StackLock lock(_mutex, "IMuseDigital::getStreamStats()");
+	return _streamStats;
+}
+
+BundleDirCache::BlockCacheStats IMuseDigital::getBlockCacheStats(int &numCachedBlocks) {
+	Common::StackLock lock(_mutex, "IMuseDigital::getBlockCacheStats()");
+	numCachedBlocks = _sound->getBundleDirCache()->getNumCachedBlocks();
+	return _sound->getBundleDirCache()->getBlockCacheStats();
+}
+
+void IMuseDigital::resetStreamStats() {
+	Common::StackLock lock(_mutex, "IMuseDigital::resetStreamStats()");
+	_streamStats.underruns = 0;
+	_streamStats.lastUnderrunSoundId = -1;
+	_sound->getBundleDirCache()->resetBlockCacheStats();
+}
+
 void IMuseDigital::switchToNextRegion(Track *track) {
 	assert(track);
 
@@ -89,6 +89,18 @@ private:
 	int _stopingSequence;
 	bool _radioChatterSFX;
 
+public:
+	/**
+	 * Streaming statistics, reported by the "imusedigi" debugger command.
+	 */
+	struct StreamStats {
+		uint32 underruns;          ///< Times the queue of a playing track ran dry before it was refilled
+		int32 lastUnderrunSoundId; ///< Sound of the track that ran dry last, or -1
+	};
+
+private:
+	StreamStats _streamStats;
+
 	static void timer_handler(void *refConf);
 	void callback();
 	void switchToNextRegion(Track *track);
@@ -162,6 +174,10 @@ public:
 	int32 getCurMusicLipSyncWidth(int syncId);
 	int32 getCurMusicLipSyncHeight(int syncId);
 	int32 getSoundElapsedTimeInMs(int soundId);
+
+	StreamStats getStreamStats();
+	BundleDirCache::BlockCacheStats getBlockCacheStats(int &numCachedBlocks);
+	void resetStreamStats();
 };
 
 } // End of namespace Scumm
@@ -38,6 +38,8 @@ BundleDirCache::BundleDirCache() {
 		_budleDirCache[fileId].isCompressed = false;
 		_budleDirCache[fileId].indexTable = NULL;
 	}
+	_blockUseCounter = 0;
+	resetBlockCacheStats();
 }
 
 BundleDirCache::~BundleDirCache() {
@@ -45,6 +47,7 @@ BundleDirCache::~BundleDirCache() {
 		free(_budleDirCache[fileId].bundleTable);
 		free(_budleDirCache[fileId].indexTable);
 	}
+	flushBlocks();
 }
 
 BundleDirCache::AudioTable *BundleDirCache::getTable(int slot) {
@@ -139,6 +142,70 @@ int BundleDirCache::matchFile(const char *filename) {
 	}
 }
 
+const byte *BundleDirCache::findBlock(int slot, int32 index, int32 block, int32 &size) {
+	BlockKey key = { slot, index, block };
+	BlockMap::iterator it = _blocks.find(key);
+	if (it == _blocks.end()) {
+		_blockStats.misses++;
+		return NULL;
+	}
+
+	_blockStats.hits++;
+	it->_value->lastUsed = ++_blockUseCounter;
+	size = it->_value->size;
+	return it->_value->data;
+}
+
+bool BundleDirCache::hasBlock(int slot, int32 index, int32 block) const {
+	BlockKey key = { slot, index, block };
+	return _blocks.contains(key);
+}
+
+void BundleDirCache::storeBlock(int slot, int32 index, int32 block, const byte *data, int32 size, bool ahead) {
+	assert(size >= 0 && size <= 0x2000);
+
+	BlockKey key = { slot, index, block };
+	if (_blocks.contains(key))
+		return;
+
+	while (_blocks.size() >= kMaxCachedBlocks)
+		evictBlock();
+
+	CachedBlock *entry = new CachedBlock;
+	memcpy(entry->data, data, size);
+	entry->size = size;
+	entry->lastUsed = ++_blockUseCounter;
+	_blocks[key] = entry;
+
+	if (ahead)
+		_blockStats.decodedAhead++;
+}
+
+void BundleDirCache::evictBlock() {
+	BlockMap::iterator oldest = _blocks.end();
+	for (BlockMap::iterator it = _blocks.begin(); it != _blocks.end(); ++it) {
+		if (oldest == _blocks.end() || it->_value->lastUsed < oldest->_value->lastUsed)
+			oldest = it;
+	}
+
+	if (oldest == _blocks.end())
+		return;
+
+	delete oldest->_value;
+	_blocks.erase(oldest);
+	_blockStats.evictions++;
+}
+
+void BundleDirCache::flushBlocks() {
+	for (BlockMap::iterator it = _blocks.begin(); it != _blocks.end(); ++it)
+		delete it->_value;
+	_blocks.clear();
+}
+
+void BundleDirCache::resetBlockCacheStats() {
+	memset(&_blockStats, 0, sizeof(_blockStats));
+}
+
 BundleMgr::BundleMgr(BundleDirCache *cache) {
 	_cache = cache;
 	_bundleTable = NULL;
@@ -147,6 +214,7 @@ BundleMgr::BundleMgr(BundleDirCache *cache) {
 	_numCompItems = 0;
 	_curSampleId = -1;
 	_fileBundleId = -1;
+	_slot = -1;
 	_file = new ScummFile();
 	_compInputBuff = NULL;
 }
@@ -192,6 +260,7 @@ bool BundleMgr::open(const char *filename, bool &compressed, bool errorFlag) {
 	_bundleTable = _cache->getTable(slot);
 	_indexTable = _cache->getIndexTable(slot);
 	assert(_bundleTable);
+	_slot = slot;
 	_compTableLoaded = false;
 	_outputSize = 0;
 	_lastBlock = -1;
@@ -209,6 +278,7 @@ void BundleMgr::close() {
 		_lastBlock = -1;
 		_outputSize = 0;
 		_curSampleId = -1;
+		_slot = -1;
 		free(_compTable);
 		_compTable = NULL;
 		free(_compInputBuff);
@@ -246,6 +316,37 @@ bool BundleMgr::loadCompTable(int32 index) {
 	return true;
 }
 
+void BundleMgr::decodeBlock(int32 index, int32 block) {
+	// CMI hack: one more zero byte at the end of input buffer
+	_compInputBuff[_compTable[block].size] = 0;
+	_file->seek(_bundleTable[index].offset + _compTable[block].offset, SEEK_SET);
+	_file->read(_compInputBuff, _compTable[block].size);
+	_outputSize = BundleCodecs::decompressCodec(_compTable[block].codec, _compInputBuff, _compOutputBuff, _compTable[block].size);
+	if (_outputSize > 0x2000) {
+		error("_outputSize: %d", _outputSize);
+	}
+	_lastBlock = block;
+}
+
+bool BundleMgr::decodeAheadOfCurIndex(int32 offset, int headerSize, int numBlocks) {
+	if (!_file->isOpen() || _curSampleId == -1 || !_compTableLoaded)
+		return false;
+
+	int32 firstBlock = (offset + headerSize) / 0x2000 + 1;
+	int32 lastBlock = MIN<int32>(firstBlock + numBlocks, _numCompItems) - 1;
+
+	for (int32 i = firstBlock; i <= lastBlock; i++) {
+		if (i == _lastBlock || _cache->hasBlock(_slot, _curSampleId, i))
+			continue;
+
+		decodeBlock(_curSampleId, i);
+		_cache->storeBlock(_slot, _curSampleId, i, _compOutputBuff, _outputSize, true);
+		return true;
+	}
+
+	return false;
+}
+
 int32 BundleMgr::decompressSampleByCurIndex(int32 offset, int32 size, byte **compFinal, int headerSize, bool headerOutside) {
 	return decompressSampleByIndex(_curSampleId, offset, size, compFinal, headerSize, headerOutside);
 }
@@ -288,15 +389,16 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 
 	for (i = firstBlock; i <= lastBlock; i++) {
 		if (_lastBlock != i) {
-			// CMI hack: one more zero byte at the end of input buffer
-			_compInputBuff[_compTable[i].size] = 0;
-			_file->seek(_bundleTable[index].offset + _compTable[i].offset, SEEK_SET);
-			_file->read(_compInputBuff, _compTable[i].size);
-			_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
-			if (_outputSize > 0x2000) {
-				error("_outputSize: %d", _outputSize);
+			int32 cachedSize;
+			const byte *cached = _cache->findBlock(_slot, index, i, cachedSize);
+			if (cached) {
+				memcpy(_compOutputBuff, cached, cachedSize);
+				_outputSize = cachedSize;
+				_lastBlock = i;
+			} else {
+				decodeBlock(index, i);
+				_cache->storeBlock(_slot, index, i, _compOutputBuff, _outputSize, false);
 			}
-			_lastBlock = i;
 		}
 
 		outputSize = _outputSize;
@@ -25,6 +25,7 @@
 
 #include "common/scummsys.h"
 #include "common/file.h"
+#include "common/hashmap.h"
 
 namespace Scumm {
 
@@ -43,8 +44,51 @@ public:
 		int32 index;
 	};
 
+	/**
+	 * Usage statistics of the decoded block cache, reported by the
+	 * "imusedigi" debugger command.
+	 */
+	struct BlockCacheStats {
+		uint32 hits;         ///< Blocks served from the cache
+		uint32 misses;       ///< Blocks decoded while the mixer was waiting for them
+		uint32 decodedAhead; ///< Blocks decoded ahead of the read position of a track
+		uint32 evictions;    ///< Blocks dropped to stay within the cache size
+	};
+
+	/** Maximum number of decoded 8 KB blocks kept around, shared by all tracks. */
+	static const int kMaxCachedBlocks = 64;
+
 private:
 
+	struct BlockKey {
+		int slot;       ///< Bundle dir cache slot of the bundle file
+		int32 index;    ///< Sample index inside the bundle
+		int32 block;    ///< Block number inside the sample
+
+		bool operator==(const BlockKey &other) const {
+			return slot == other.slot && index == other.index && block == other.block;
+		}
+	};
+
+	struct BlockKeyHash {
+		uint operator()(const BlockKey &key) const {
+			return (uint)((key.slot * 31 + key.index) * 4099 + key.block);
+		}
+	};
+
+	struct CachedBlock {
+		byte data[0x2000];
+		int32 size;
+		uint32 lastUsed;
+	};
+
+	typedef Common::HashMap<BlockKey, CachedBlock *, BlockKeyHash> BlockMap;
+	BlockMap _blocks;
+	uint32 _blockUseCounter;
+	BlockCacheStats _blockStats;
+
+	void evictBlock();
+
 	struct FileDirCache {
 		char fileName[20];
 		AudioTable *bundleTable;
@@ -62,6 +106,19 @@ public:
 	IndexNode *getIndexTable(int slot);
 	int32 getNumFiles(int slot);
 	bool isSndDataExtComp(int slot);
+
+	/**
+	 * Look up a decoded block. Returns NULL if the block is not cached,
+	 * otherwise marks it as recently used and returns its data.
+	 */
+	const byte *findBlock(int slot, int32 index, int32 block, int32 &size);
+	bool hasBlock(int slot, int32 index, int32 block) const;
+	void storeBlock(int slot, int32 index, int32 block, const byte *data, int32 size, bool ahead);
+	void flushBlocks();
+
+	const BlockCacheStats &getBlockCacheStats() const { return _blockStats; }
+	void resetBlockCacheStats();
+	int getNumCachedBlocks() const { return _blocks.size(); }
 };
 
 class BundleMgr {
@@ -85,12 +142,14 @@ private:
 	BaseScummFile *_file;
 	bool _compTableLoaded;
 	int _fileBundleId;
+	int _slot;
 	byte _compOutputBuff[0x2000];
 	byte *_compInputBuff;
 	int _outputSize;
 	int _lastBlock;
 
 	bool loadCompTable(int32 index);
+	void decodeBlock(int32 index, int32 block);
 
 public:
 
@@ -103,6 +162,13 @@ public:
 	int32 decompressSampleByName(const char *name, int32 offset, int32 size, byte **compFinal, bool headerOutside);
 	int32 decompressSampleByIndex(int32 index, int32 offset, int32 size, byte **compFinal, int header_size, bool headerOutside);
 	int32 decompressSampleByCurIndex(int32 offset, int32 size, byte **compFinal, int headerSize, bool headerOutside);
+
+	/**
+	 * Decode one not yet cached block out of the next few blocks following
+	 * the given offset of the current sample, so they are ready before the
+	 * mixer asks for them. Returns true if a block was decoded.
+	 */
+	bool decodeAheadOfCurIndex(int32 offset, int headerSize, int numBlocks);
 };
 
 } // End of namespace Scumm
@@ -633,6 +633,23 @@ int ImuseDigiSndMgr::getJumpFade(SoundDesc *soundDesc, int number) {
 	return soundDesc->jump[number].fadeDelay;
 }
 
+/**
+ * Decode some of the bundle blocks that follow the given read position, so
+ * they are already cached when getDataFromRegion() asks for them. Only
+ * COMP-compressed bundles are handled; the other formats either are in
+ * memory already or are decoded by their own audio streams.
+ */
+bool ImuseDigiSndMgr::decodeAheadOfRegion(SoundDesc *soundDesc, int region, int32 offset) {
+	assert(checkForProperHandle(soundDesc));
+	assert(region >= 0 && region < soundDesc->numRegions);
+
+	if (!soundDesc->bundle || soundDesc->compressed)
+		return false;
+
+	int32 start = soundDesc->region[region].offset - soundDesc->offsetData;
+	return soundDesc->bundle->decodeAheadOfCurIndex(start + offset, soundDesc->offsetData, IMUSE_DECODE_AHEAD_BLOCKS);
+}
+
 int32 ImuseDigiSndMgr::getDataFromRegion(SoundDesc *soundDesc, int region, byte **buf, int32 offset, int32 size) {
 	debug(6, "getDataFromRegion() region:%d, offset:%d, size:%d, numRegions:%d", region, offset, size, soundDesc->numRegions);
 	assert(checkForProperHandle(soundDesc));
@@ -52,6 +52,8 @@ public:
 #define IMUSE_VOLGRP_SFX 2
 #define IMUSE_VOLGRP_MUSIC 3
 
+#define IMUSE_DECODE_AHEAD_BLOCKS 4
+
 private:
 	struct Region {
 		int32 offset;		// offset of region
@@ -154,6 +156,9 @@ public:
 	void getSyncSizeAndPtrById(SoundDesc *soundDesc, int number, int32 &sync_size, byte **sync_ptr);
 
 	int32 getDataFromRegion(SoundDesc *soundDesc, int region, byte **buf, int32 offset, int32 size);
+	bool decodeAheadOfRegion(SoundDesc *soundDesc, int region, int32 offset);
+
+	BundleDirCache *getBundleDirCache() { return _cacheBundleDir; }
 };
 
 } // End of namespace Scumm
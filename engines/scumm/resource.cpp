@@ -612,12 +612,29 @@ void ScummEngine::ensureResourceLoaded(ResType type, ResId idx) {
 	if (idx <= _res->_types[type].size() && _res->_types[type][idx]._address)
 		return;
 
+	const uint32 startTime = _system->getMillis();
 	loadResource(type, idx);
+	_res->recordDemandLoad(_system->getMillis() - startTime);
 
 	if (_game.version == 5 && type == rtRoom && (int)idx == _roomResource)
 		VAR(VAR_ROOM_FLAG) = 1;
 }
 
+void ScummEngine::prefetchResources() {
+	// Prefetching reads from the data file of the current room, so only
+	// do it for games where that is simple and cheap
+	if (_game.version < 3 || _game.heversion != 0)
+		return;
+
+	ResType type;
+	ResId idx;
+	if (_res->getNextPrefetch(type, idx)) {
+		debugC(DEBUG_RESOURCE, "Prefetching %s %d", nameOfResType(type), idx);
+		loadResource(type, idx);
+		_res->recordPrefetchLoad();
+	}
+}
+
 int ScummEngine::loadResource(ResType type, ResId idx) {
 	int roomNr;
 	uint32 fileOffs;
@@ -833,6 +850,7 @@ byte *ResourceManager::createResource(ResType type, ResId idx, uint32 size) {
 
 	_types[type][idx]._address = ptr;
 	_types[type][idx]._size = size;
+	_types[type][idx]._generation = ++_lastGeneration;
 	setResourceCounter(type, idx, 1);
 	return ptr;
 }
@@ -844,6 +862,7 @@ ResourceManager::Resource::Resource() {
 	_status = 0;
 	_roomno = 0;
 	_roomoffs = 0;
+	_generation = 0;
 }
 
 ResourceManager::Resource::~Resource() {
@@ -872,6 +891,8 @@ ResourceManager::ResourceManager(ScummEngine *vm) : _vm(vm) {
 	_maxHeapThreshold = 0;
 	_minHeapThreshold = 0;
 	_expireCounter = 0;
+	_lastGeneration = 0;
+	memset(&_stats, 0, sizeof(_stats));
 }
 
 ResourceManager::~ResourceManager() {
@@ -899,6 +920,7 @@ void ResourceManager::nukeResource(ResType type, ResId idx) {
 		debugC(DEBUG_RESOURCE, "nukeResource(%s,%d)", nameOfResType(type), idx);
 		_allocatedSize -= _types[type][idx]._size;
 		_types[type][idx].nuke();
+		_types[type][idx]._generation = ++_lastGeneration;
 	}
 }
 
@@ -1032,8 +1054,24 @@ void ResourceManager::Resource::setOnHeap() {
 	_status &= ~RF_OFFHEAP;
 }
 
+int ResourceManager::getExpiryBias(ResType type) {
+	switch (type) {
+	case rtSound:
+		// Sounds are large and only needed while they are playing (which
+		// isResourceInUse checks), so they are the first to go
+		return 16;
+	case rtCostume:
+	case rtCharset:
+		// Reloading these makes actors or text appear with a noticeable
+		// delay, so keep them around for longer
+		return -16;
+	default:
+		return 0;
+	}
+}
+
 void ResourceManager::expireResources(uint32 size) {
-	byte best_counter;
+	int best_score;
 	ResType best_type;
 	int best_res = 0;
 	uint32 oldAllocatedSize;
@@ -1050,18 +1088,21 @@ void ResourceManager::expireResources(uint32 size) {
 
 	do {
 		best_type = rtInvalid;
-		best_counter = 2;
+		best_score = 0;
 
 		for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
 			if (_types[type]._mode != kDynamicResTypeMode) {
 				// Resources of this type can be reloaded from the data files,
 				// so we can potentially unload them to free memory.
+				const int bias = getExpiryBias(type);
 				ResId idx = _types[type].size();
 				while (idx-- > 0) {
 					Resource &tmp = _types[type][idx];
 					byte counter = tmp.getResourceCounter();
-					if (!tmp.isLocked() && counter >= best_counter && tmp._address && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
-						best_counter = counter;
+					// Resources used since the counters were last increased
+					// (i.e. with a count of 1) are never expired
+					if (!tmp.isLocked() && counter >= 2 && (best_type == rtInvalid || counter + bias >= best_score) && tmp._address && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
+						best_score = counter + bias;
 						best_type = type;
 						best_res = idx;
 					}
@@ -1071,6 +1112,9 @@ void ResourceManager::expireResources(uint32 size) {
 
 		if (!best_type)
 			break;
+		debugC(DEBUG_RESOURCE, "Expiring %s %d (%d bytes)", nameOfResType(best_type), best_res, _types[best_type][best_res]._size);
+		_stats.evictions++;
+		_stats.evictedSize += _types[best_type][best_res]._size;
 		nukeResource(best_type, best_res);
 	} while (size + _allocatedSize > _minHeapThreshold);
 
@@ -1119,6 +1163,12 @@ bool ResourceManager::isResourceLoaded(ResType type, ResId idx) const {
 	return _types[type][idx]._address != NULL;
 }
 
+uint32 ResourceManager::getResourceGeneration(ResType type, ResId idx) const {
+	if (!validateResource("getResourceGeneration", type, idx))
+		return 0;
+	return _types[type][idx]._generation;
+}
+
 void ResourceManager::resourceStats() {
 	uint32 lockedSize = 0, lockedNum = 0;
 
@@ -1133,7 +1183,63 @@ void ResourceManager::resourceStats() {
 		}
 	}
 
-	debug(1, "Total allocated size=%d, locked=%d(%d)", _allocatedSize, lockedSize, lockedNum);
+	debug(1, "Total allocated size=%d, locked=%d(%d), budget=%d", _allocatedSize, lockedSize, lockedNum, _maxHeapThreshold);
+	debug(1, "Demand loads=%d (%d ms, max %d ms), prefetched=%d, expired=%d (%d bytes)",
+		_stats.demandLoads, _stats.demandLoadTime, _stats.maxDemandLoadTime,
+		_stats.prefetchLoads, _stats.evictions, _stats.evictedSize);
+}
+
+void ResourceManager::recordDemandLoad(uint32 time) {
+	_stats.demandLoads++;
+	_stats.demandLoadTime += time;
+	_stats.maxDemandLoadTime = MAX(_stats.maxDemandLoadTime, time);
+}
+
+void ResourceManager::queueRoomPrefetch(int room) {
+	static const ResType prefetchTypes[] = { rtScript, rtCostume };
+
+	_prefetchQueue.clear();
+
+	// Resources with room 0 are looked up in whatever room is current when
+	// they are loaded, so they are not necessarily stored in this room
+	if (room <= 0)
+		return;
+
+	for (int i = 0; i < ARRAYSIZE(prefetchTypes); ++i) {
+		const ResType type = prefetchTypes[i];
+		for (ResId idx = 1; idx < _types[type].size(); ++idx) {
+			const Resource &res = _types[type][idx];
+			if (!res._address && res._roomno == room && res._roomoffs != RES_INVALID_OFFSET) {
+				PrefetchEntry entry;
+				entry.type = type;
+				entry.idx = idx;
+				_prefetchQueue.push_back(entry);
+			}
+		}
+	}
+
+	debugC(DEBUG_RESOURCE, "Queued %d resources of room %d for prefetching", _prefetchQueue.size(), room);
+}
+
+bool ResourceManager::getNextPrefetch(ResType &type, ResId &idx) {
+	while (!_prefetchQueue.empty()) {
+		// Never let prefetching push other resources out
+		if (_allocatedSize >= _minHeapThreshold) {
+			_prefetchQueue.clear();
+			return false;
+		}
+
+		const PrefetchEntry entry = _prefetchQueue.back();
+		_prefetchQueue.pop_back();
+
+		if (!_types[entry.type][entry.idx]._address) {
+			type = entry.type;
+			idx = entry.idx;
+			return true;
+		}
+	}
+
+	return false;
 }
 
 void ScummEngine_v5::readMAXS(int blockSize) {
@@ -126,6 +126,13 @@ public:
 		 */
 		uint32 _roomoffs;
 
+		/**
+		 * Changes whenever the resource is created or nuked, so data derived
+		 * from it can tell when it is outdated. Values are unique across all
+		 * resources, see ResourceManager::_lastGeneration.
+		 */
+		uint32 _generation;
+
 	public:
 		Resource();
 		~Resource();
@@ -171,11 +178,36 @@ public:
 	};
 	ResTypeData _types[rtLast + 1];
 
+	/**
+	 * Load and expiry statistics, reported by resourceStats().
+	 */
+	struct Stats {
+		uint32 demandLoads;        ///< Resources loaded from disk when they were first needed
+		uint32 demandLoadTime;     ///< Total time spent in demand loads, in ms
+		uint32 maxDemandLoadTime;  ///< Longest single demand load, in ms
+		uint32 prefetchLoads;      ///< Resources loaded ahead of time by the prefetcher
+		uint32 evictions;          ///< Resources expired to stay within the heap budget
+		uint32 evictedSize;        ///< Total size of the expired resources
+	};
+
 protected:
 	uint32 _allocatedSize;
 	uint32 _maxHeapThreshold, _minHeapThreshold;
 	byte _expireCounter;
 
+	/** Last generation handed out to a created or nuked resource */
+	uint32 _lastGeneration;
+
+	Stats _stats;
+
+	struct PrefetchEntry {
+		ResType type;
+		ResId idx;
+	};
+
+	/** Resources of the current room which still need to be prefetched. */
+	Common::Array<PrefetchEntry> _prefetchQueue;
+
 public:
 	ResourceManager(ScummEngine *vm);
 	~ResourceManager();
@@ -192,6 +224,7 @@ public:
 //	inline const Resource &getRes(ResType type, ResId idx) const { return _types[type][idx]; }
 
 	bool isResourceLoaded(ResType type, ResId idx) const;
+	uint32 getResourceGeneration(ResType type, ResId idx) const;
 
 	void lock(ResType type, ResId idx);
 	void unlock(ResType type, ResId idx);
@@ -225,10 +258,45 @@ public:
 
 	void resourceStats();
 
+	const Stats &getStats() const { return _stats; }
+	uint32 getAllocatedSize() const { return _allocatedSize; }
+	uint32 getMaxHeapThreshold() const { return _maxHeapThreshold; }
+
+	/**
+	 * Record the time taken by loading a resource on first use.
+	 */
+	void recordDemandLoad(uint32 time);
+
+	/**
+	 * Queue the scripts and costumes stored in the given room, so they can
+	 * be loaded one at a time while the room is running, instead of in the
+	 * middle of a frame when they are first used. Replaces any previously
+	 * queued resources.
+	 */
+	void queueRoomPrefetch(int room);
+
+	/**
+	 * Get the next queued resource to prefetch. Returns false if the queue
+	 * is empty, or if loading more resources would exceed the heap budget.
+	 */
+	bool getNextPrefetch(ResType &type, ResId &idx);
+
+	/**
+	 * Record that a resource was loaded by the prefetcher.
+	 */
+	void recordPrefetchLoad() { _stats.prefetchLoads++; }
+
 //protected:
 	bool validateResource(const char *str, ResType type, ResId idx) const;
 protected:
 	void expireResources(uint32 size);
+
+	/**
+	 * Bias added to the age of resources of the given type when choosing
+	 * which resource to expire. Resources with a higher biased age are
+	 * expired first.
+	 */
+	static int getExpiryBias(ResType type);
 };
 
 } // End of namespace Scumm
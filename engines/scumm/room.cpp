@@ -167,6 +167,10 @@ void ScummEngine::startScene(int room, Actor *a, int objectNr) {
 		camera._cur.y = camera._dest.y = _screenHeight / 2;
 	}
 
+	// Queue the scripts and costumes of the new room, so they can be
+	// loaded before they are needed
+	_res->queueRoomPrefetch(_roomResource);
+
 	if (_roomResource == 0)
 		return;
 
@@ -587,6 +587,8 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 		_herculesBuf = (byte *)malloc(kHercWidth * kHercHeight);
 	}
 
+	resetScreenUpdateStats();
+
 	// Add debug levels
 	for (int i = 0; i < ARRAYSIZE(debugChannels); ++i)
 		DebugMan.addDebugChannel(debugChannels[i].flag,  debugChannels[i].channel, debugChannels[i].desc);
@@ -1431,7 +1433,14 @@ void ScummEngine::setupScumm() {
 		maxHeapThreshold = 550000;
 	}
 
-	_res->setHeapThreshold(400000, maxHeapThreshold);
+	// Allow overriding the heap budget (in KB), e.g. for low memory devices
+	if (ConfMan.hasKey("scumm_resource_budget")) {
+		const int budget = ConfMan.getInt("scumm_resource_budget");
+		if (budget > 0)
+			maxHeapThreshold = budget * 1024;
+	}
+
+	_res->setHeapThreshold(MIN(400000, maxHeapThreshold), maxHeapThreshold);
 
 	free(_compositeBuf);
 	_compositeBuf = (byte *)malloc(_screenWidth * _textSurfaceMultiplier * _screenHeight * _textSurfaceMultiplier * _outputPixelFormat.bytesPerPixel);
@@ -2371,6 +2380,7 @@ load_game:
 	camera._last = camera._cur;
 
 	_res->increaseExpireCounter();
+	prefetchResources();
 
 	animateCursor();
 
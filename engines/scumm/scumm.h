@@ -39,6 +39,7 @@
 #include "graphics/surface.h"
 #include "graphics/sjis.h"
 
+#include "scumm/boxes.h"
 #include "scumm/gfx.h"
 #include "scumm/detection.h"
 #include "scumm/script.h"
@@ -92,7 +93,6 @@ class ScummDebugger;
 class Sound;
 
 struct Box;
-struct BoxCoords;
 struct FindObjectInRoom;
 
 // Use g_scumm from error() ONLY
@@ -765,6 +765,9 @@ public:
 	byte *getStringAddressVar(int i);
 	void ensureResourceLoaded(ResType type, ResId idx);
 
+	/** Load the next resource queued by ResourceManager::queueRoomPrefetch. */
+	void prefetchResources();
+
 protected:
 	int readSoundResource(ResId idx);
 	int readSoundResourceSmallHeader(ResId idx);
@@ -1048,6 +1051,23 @@ protected:
 	void drawStripToScreen(VirtScreen *vs, int x, int w, int t, int b);
 	void ditherCGA(byte *dst, int dstPitch, int x, int y, int width, int height) const;
 
+public:
+	/**
+	 * Counts of the rects handed to the backend, reported by the
+	 * "screenupdates" debugger command.
+	 */
+	struct ScreenUpdateStats {
+		uint32 frames;
+		uint32 uploads;         ///< copyRectToScreen() calls
+		uint32 uploadedPixels;
+	};
+
+	const ScreenUpdateStats &getScreenUpdateStats() const { return _screenUpdateStats; }
+	void resetScreenUpdateStats() { memset(&_screenUpdateStats, 0, sizeof(_screenUpdateStats)); }
+
+protected:
+	ScreenUpdateStats _screenUpdateStats;
+
 public:
 	VirtScreen *findVirtScreen(int y);
 	byte *getMaskBuffer(int x, int y, int z);
@@ -1176,6 +1196,27 @@ protected:
 	void createBoxMatrix();
 	virtual bool areBoxesNeighbors(int i, int j);
 
+	/**
+	 * Walkbox data decoded from the rtMatrix resources, so that the box
+	 * queries issued for every walking actor on every frame do not have
+	 * to parse the resources again. See updateBoxCache().
+	 */
+	struct BoxCache {
+		uint32 boxGeneration;            ///< Generation of the box data (rtMatrix 2) the cache was built for
+		uint32 matrixGeneration;         ///< Generation of the box matrix (rtMatrix 1) nextBox was built for
+		int numBoxes;
+		Common::Array<BoxCoords> coords; ///< Coordinates of every box
+		Common::Array<byte> neighbors;   ///< Geometric adjacency of box pairs: 0 = not computed, 1 = apart, 2 = touching
+		Common::Array<int8> nextBox;     ///< Decoded box matrix (v3+), filled on first use
+
+		BoxCache() : boxGeneration(0), matrixGeneration(0), numBoxes(0) {}
+	};
+	BoxCache _boxCache;
+
+	void updateBoxCache();
+	void buildNextBoxTable();
+	BoxCoords readBoxCoordinates(int boxnum);
+
 	/* String class */
 public:
 	CharsetRenderer *_charset;
@@ -235,46 +235,21 @@ void Codec37Decoder::maketable(int pitch, int index) {
 	}
 }
 
-#if defined(SCUMM_NEED_ALIGNMENT)
-
-#define DECLARE_LITERAL_TEMP(v)			\
-	byte v
-
-#define READ_LITERAL_PIXEL(src, v)		\
-	v = *src++
-
-#define WRITE_4X1_LINE(dst, v)			\
-	do {					\
-		int j;				\
-		for (j=0; j<4; j++)		\
-			(dst)[j] = v;		\
-	} while (0)
-
-#define COPY_4X1_LINE(dst, src)			\
-	do {					\
-		int j;				\
-		for (j=0; j<4; j++)		\
-			(dst)[j] = (src)[j];	\
-	} while (0)
-
-#else /* SCUMM_NEED_ALIGNMENT */
+// memmove with a constant size compiles down to a single (unaligned if
+// needed) load and store, and is safe on platforms which need aligned memory
+// access, so the same word sized kernels are used everywhere.
 
 #define DECLARE_LITERAL_TEMP(v)			\
 	uint32 v
 
-#define READ_LITERAL_PIXEL(src, v)			\
-	do {						\
-		v = *src++;				\
-		v += (v << 8) + (v << 16) + (v << 24);	\
-	} while (0)
+#define READ_LITERAL_PIXEL(src, v)		\
+	v = *src++ * 0x01010101U
 
 #define WRITE_4X1_LINE(dst, v)			\
-	*(uint32 *)(dst) = v
+	WRITE_UINT32((dst), v)
 
 #define COPY_4X1_LINE(dst, src)			\
-	*(uint32 *)(dst) = *(const uint32 *)(src)
-
-#endif /* SCUMM_NEED_ALIGNMENT */
+	memmove((dst), (src), 4)
 
 /* Fill a 4x4 pixel block with a literal pixel value */
 
@@ -29,46 +29,31 @@
 
 namespace Scumm {
 
-#if defined(SCUMM_NEED_ALIGNMENT)
+// The copies and fills below work on whole rows of a block at once. memmove
+// with a constant size compiles down to a single (unaligned if needed) load
+// and store, and is safe on platforms which need aligned memory access.
+// The fill macros take the fill value replicated into every byte.
 
-#define COPY_4X1_LINE(dst, src)			\
-	do {					\
-		(dst)[0] = (src)[0];	\
-		(dst)[1] = (src)[1];	\
-		(dst)[2] = (src)[2];	\
-		(dst)[3] = (src)[3];	\
-	} while (0)
-
-#define COPY_2X1_LINE(dst, src)			\
-	do {					\
-		(dst)[0] = (src)[0];	\
-		(dst)[1] = (src)[1];	\
-	} while (0)
-
-
-#else /* SCUMM_NEED_ALIGNMENT */
+#define COPY_8X1_LINE(dst, src)			\
+	memmove((dst), (src), 8)
 
 #define COPY_4X1_LINE(dst, src)			\
-	*(uint32 *)(dst) = *(const uint32 *)(src)
+	memmove((dst), (src), 4)
 
 #define COPY_2X1_LINE(dst, src)			\
-	*(uint16 *)(dst) = *(const uint16 *)(src)
+	memmove((dst), (src), 2)
 
-#endif
-
-#define FILL_4X1_LINE(dst, val)			\
+#define FILL_8X1_LINE(dst, val)			\
 	do {					\
-		(dst)[0] = val;	\
-		(dst)[1] = val;	\
-		(dst)[2] = val;	\
-		(dst)[3] = val;	\
+		WRITE_UINT32((dst), val);	\
+		WRITE_UINT32((dst) + 4, val);	\
 	} while (0)
 
+#define FILL_4X1_LINE(dst, val)			\
+	WRITE_UINT32((dst), val)
+
 #define FILL_2X1_LINE(dst, val)			\
-	do {					\
-		(dst)[0] = val;	\
-		(dst)[1] = val;	\
-	} while (0)
+	WRITE_UINT16((dst), val)
 
 static const  int8 codec47_table_small1[] = {
   0, 1, 2, 3, 3, 3, 3, 2, 1, 0, 0, 0, 1, 2, 2, 1,
@@ -373,7 +358,7 @@ void Codec47Decoder::level3(byte *d_dst) {
 		COPY_2X1_LINE(d_dst + _d_pitch, _d_src + 2);
 		_d_src += 4;
 	} else if (code == 0xFE) {
-		byte t = *_d_src++;
+		uint16 t = *_d_src++ * 0x0101;
 		FILL_2X1_LINE(d_dst, t);
 		FILL_2X1_LINE(d_dst + _d_pitch, t);
 	} else if (code == 0xFC) {
@@ -381,7 +366,7 @@ void Codec47Decoder::level3(byte *d_dst) {
 		COPY_2X1_LINE(d_dst, d_dst + tmp);
 		COPY_2X1_LINE(d_dst + _d_pitch, d_dst + _d_pitch + tmp);
 	} else {
-		byte t = _paramPtr[code];
+		uint16 t = _paramPtr[code] * 0x0101;
 		FILL_2X1_LINE(d_dst, t);
 		FILL_2X1_LINE(d_dst + _d_pitch, t);
 	}
@@ -407,7 +392,7 @@ void Codec47Decoder::level2(byte *d_dst) {
 		d_dst += 2;
 		level3(d_dst);
 	} else if (code == 0xFE) {
-		byte t = *_d_src++;
+		uint32 t = *_d_src++ * 0x01010101U;
 		for (i = 0; i < 4; i++) {
 			FILL_4X1_LINE(d_dst, t);
 			d_dst += _d_pitch;
@@ -435,7 +420,7 @@ void Codec47Decoder::level2(byte *d_dst) {
 			d_dst += _d_pitch;
 		}
 	} else {
-		byte t = _paramPtr[code];
+		uint32 t = _paramPtr[code] * 0x01010101U;
 		for (i = 0; i < 4; i++) {
 			FILL_4X1_LINE(d_dst, t);
 			d_dst += _d_pitch;
@@ -451,8 +436,7 @@ void Codec47Decoder::level1(byte *d_dst) {
 	if (code < 0xF8) {
 		tmp2 = _table[code] + _offset1;
 		for (i = 0; i < 8; i++) {
-			COPY_4X1_LINE(d_dst + 0, d_dst + tmp2);
-			COPY_4X1_LINE(d_dst + 4, d_dst + tmp2 + 4);
+			COPY_8X1_LINE(d_dst, d_dst + tmp2);
 			d_dst += _d_pitch;
 		}
 	} else if (code == 0xFF) {
@@ -464,10 +448,9 @@ void Codec47Decoder::level1(byte *d_dst) {
 		d_dst += 4;
 		level2(d_dst);
 	} else if (code == 0xFE) {
-		byte t = *_d_src++;
+		uint32 t = *_d_src++ * 0x01010101U;
 		for (i = 0; i < 8; i++) {
-			FILL_4X1_LINE(d_dst, t);
-			FILL_4X1_LINE(d_dst + 4, t);
+			FILL_8X1_LINE(d_dst, t);
 			d_dst += _d_pitch;
 		}
 	} else if (code == 0xFD) {
@@ -490,15 +473,13 @@ void Codec47Decoder::level1(byte *d_dst) {
 	} else if (code == 0xFC) {
 		tmp2 = _offset2;
 		for (i = 0; i < 8; i++) {
-			COPY_4X1_LINE(d_dst + 0, d_dst + tmp2);
-			COPY_4X1_LINE(d_dst + 4, d_dst + tmp2 + 4);
+			COPY_8X1_LINE(d_dst, d_dst + tmp2);
 			d_dst += _d_pitch;
 		}
 	} else {
-		byte t = _paramPtr[code];
+		uint32 t = _paramPtr[code] * 0x01010101U;
 		for (i = 0; i < 8; i++) {
-			FILL_4X1_LINE(d_dst, t);
-			FILL_4X1_LINE(d_dst + 4, t);
+			FILL_8X1_LINE(d_dst, t);
 			d_dst += _d_pitch;
 		}
 	}
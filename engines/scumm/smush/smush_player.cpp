@@ -249,7 +249,10 @@ SmushPlayer::SmushPlayer(ScummEngine_v7 *scumm) {
 	_paused = false;
 	_pauseStartTime = 0;
 	_pauseTime = 0;
-
+	_frameObjectBuffer = NULL;
+	_frameObjectBufferSize = 0;
+	memset(&_frameStats, 0, sizeof(_frameStats));
+	_frameDecodeTime = 0;
 
 	_IACTchannel = new Audio::SoundHandle();
 	_compressedFileSoundHandle = new Audio::SoundHandle();
@@ -267,6 +270,9 @@ void SmushPlayer::init(int32 speed) {
 	_speed = speed;
 	_endOfFile = false;
 
+	memset(&_frameStats, 0, sizeof(_frameStats));
+	_frameDecodeTime = 0;
+
 	_vm->_smushVideoShouldFinish = false;
 	_vm->_smushActive = true;
 
@@ -310,6 +316,10 @@ void SmushPlayer::release() {
 	free(_frameBuffer);
 	_frameBuffer = NULL;
 
+	free(_frameObjectBuffer);
+	_frameObjectBuffer = NULL;
+	_frameObjectBufferSize = 0;
+
 	_IACTstream = NULL;
 
 	_vm->_smushActive = false;
@@ -757,6 +767,8 @@ void SmushPlayer::decodeFrameObject(int codec, const uint8 *src, int left, int t
 		_height = _vm->_screenHeight;
 	}
 
+	const uint32 startTime = _vm->_system->getMillis();
+
 	switch (codec) {
 	case 1:
 	case 3:
@@ -778,6 +790,8 @@ void SmushPlayer::decodeFrameObject(int codec, const uint8 *src, int left, int t
 		error("Invalid codec for frame object : %d", codec);
 	}
 
+	_frameDecodeTime += _vm->_system->getMillis() - startTime;
+
 	if (_storeFrame) {
 		if (_frameBuffer == NULL) {
 			_frameBuffer = (byte *)malloc(_width * _height);
@@ -834,20 +848,31 @@ void SmushPlayer::handleFrameObject(int32 subSize, Common::SeekableReadStream &b
 	b.readUint16LE();
 	b.readUint16LE();
 
+	// Frame objects of a video are usually about the same size, so keep the
+	// buffer around instead of allocating a new one for every frame
 	int32 chunk_size = subSize - 14;
-	byte *chunk_buffer = (byte *)malloc(chunk_size);
-	assert(chunk_buffer);
-	b.read(chunk_buffer, chunk_size);
-
-	decodeFrameObject(codec, chunk_buffer, left, top, width, height);
+	if (chunk_size > _frameObjectBufferSize) {
+		free(_frameObjectBuffer);
+		_frameObjectBuffer = (byte *)malloc(chunk_size);
+		_frameObjectBufferSize = chunk_size;
+	}
+	assert(_frameObjectBuffer);
+	b.read(_frameObjectBuffer, chunk_size);
 
-	free(chunk_buffer);
+	decodeFrameObject(codec, _frameObjectBuffer, left, top, width, height);
 }
 
 void SmushPlayer::handleFrame(int32 frameSize, Common::SeekableReadStream &b) {
 	debugC(DEBUG_SMUSH, "SmushPlayer::handleFrame(%d)", _frame);
 	_skipNext = false;
 
+	const uint32 startTime = _vm->_system->getMillis();
+	_frameDecodeTime = 0;
+
+	// The previous frame is about to be overwritten without having been shown
+	if (_updateNeeded)
+		_frameStats.skippedFrames++;
+
 	if (_insanity) {
 		_vm->_insane->procPreRendering();
 	}
@@ -914,6 +939,15 @@ void SmushPlayer::handleFrame(int32 frameSize, Common::SeekableReadStream &b) {
 	}
 	_smixer->handleFrame();
 
+	const uint32 frameTime = _vm->_system->getMillis() - startTime;
+	_frameStats.frames++;
+	_frameStats.decodeTime += _frameDecodeTime;
+	_frameStats.maxDecodeTime = MAX(_frameStats.maxDecodeTime, _frameDecodeTime);
+	_frameStats.lastDecodeTime = _frameDecodeTime;
+	_frameStats.frameTime += frameTime;
+	_frameStats.maxFrameTime = MAX(_frameStats.maxFrameTime, frameTime);
+	debugC(DEBUG_SMUSH, "Smush stats: decode( %03d ) frame( %03d )", _frameDecodeTime, frameTime);
+
 	_frame++;
 }
 
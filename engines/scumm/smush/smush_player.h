@@ -86,10 +86,27 @@ private:
 	bool _middleAudio;
 	bool _skipPalette;
 
+	/** Reused buffer for the data of FOBJ chunks. */
+	byte *_frameObjectBuffer;
+	int32 _frameObjectBufferSize;
+
 public:
+	/** Decoding statistics of the current (or last) video. */
+	struct FrameStats {
+		uint32 frames;          ///< Number of frames handled
+		uint32 skippedFrames;   ///< Number of frames not shown because playback fell behind
+		uint32 decodeTime;      ///< Total time spent decoding frame objects, in ms
+		uint32 maxDecodeTime;   ///< Longest time spent decoding a single frame, in ms
+		uint32 lastDecodeTime;  ///< Time spent decoding the last frame, in ms
+		uint32 frameTime;       ///< Total time spent handling frames, in ms
+		uint32 maxFrameTime;    ///< Longest time spent handling a single frame, in ms
+	};
+
 	SmushPlayer(ScummEngine_v7 *scumm);
 	~SmushPlayer();
 
+	const FrameStats &getFrameStats() const { return _frameStats; }
+
 	void pause();
 	void unpause();
 
@@ -101,6 +118,8 @@ protected:
 	int _width, _height;
 
 	int _origPitch, _origNumStrips;
+	FrameStats _frameStats;
+	uint32 _frameDecodeTime;
 	bool _paused;
 	uint32 _pauseStartTime;
 	uint32 _pauseTime;
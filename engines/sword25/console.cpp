@@ -22,14 +22,93 @@
 
 #include "sword25/console.h"
 #include "sword25/sword25.h"
+#include "sword25/kernel/kernel.h"
+#include "sword25/kernel/resmanager.h"
+#include "sword25/gfx/graphicengine.h"
+#include "sword25/script/luascript.h"
 
 namespace Sword25 {
 
-Sword25Console::Sword25Console(Sword25Engine *vm) : GUI::Debugger(), _vm(vm) {
+Sword25Console::Sword25Console(Sword25Engine *vm) : GUI::Debugger(), _vm(vm),
+	_profileFrameCount(0), _profileScriptTime(0) {
 	assert(_vm);
+
+	registerCmd("lua_profile", WRAP_METHOD(Sword25Console, Cmd_LuaProfile));
+	registerCmd("res_cache", WRAP_METHOD(Sword25Console, Cmd_ResourceCache));
 }
 
 Sword25Console::~Sword25Console() {
 }
 
+bool Sword25Console::Cmd_LuaProfile(int argc, const char **argv) {
+	LuaScriptEngine *script = static_cast<LuaScriptEngine *>(Kernel::getInstance()->getScript());
+	GraphicEngine *gfx = Kernel::getInstance()->getGfx();
+	if (!script || !gfx) {
+		debugPrintf("The engine is not running\n");
+		return true;
+	}
+
+	if (argc >= 2) {
+		if (!strcmp(argv[1], "start")) {
+			uint interval = argc >= 3 ? atoi(argv[2]) : LuaScriptEngine::DEFAULT_PROFILE_INTERVAL;
+			script->resetProfile();
+			script->startProfiling(interval);
+			_profileFrameCount = gfx->getFrameCount();
+			_profileScriptTime = gfx->getScriptTime();
+			debugPrintf("Sampling every %d instructions\n", interval);
+		} else if (!strcmp(argv[1], "stop")) {
+			script->stopProfiling();
+			debugPrintf("Profiling stopped\n");
+		} else if (!strcmp(argv[1], "reset")) {
+			script->resetProfile();
+			_profileFrameCount = gfx->getFrameCount();
+			_profileScriptTime = gfx->getScriptTime();
+			debugPrintf("Profile reset\n");
+		} else {
+			debugPrintf("Usage: %s [start [<instructions>]|stop|reset]\n", argv[0]);
+		}
+		return true;
+	}
+
+	uint frames = gfx->getFrameCount() - _profileFrameCount;
+	uint scriptTime = gfx->getScriptTime() - _profileScriptTime;
+	debugPrintf("%d frames, %d ms script time per frame\n", frames, frames ? scriptTime / frames : 0);
+
+	uint total = script->getProfileSampleCount();
+	debugPrintf("%d samples%s\n", total, script->isProfiling() ? "" : " (not profiling)");
+	Common::Array<LuaScriptEngine::ProfileEntry> entries;
+	script->getProfile(entries);
+	for (uint i = 0; i < entries.size() && i < 20; i++) {
+		debugPrintf("%6d %3d%% %s\n", entries[i]._samples, entries[i]._samples * 100 / total, entries[i]._function.c_str());
+	}
+	return true;
+}
+
+bool Sword25Console::Cmd_ResourceCache(int argc, const char **argv) {
+	ResourceManager *resourceManager = Kernel::getInstance()->getResourceManager();
+	if (!resourceManager) {
+		debugPrintf("The engine is not running\n");
+		return true;
+	}
+
+	if (argc >= 2) {
+		if (!strcmp(argv[1], "budget") && argc == 3) {
+			if (!resourceManager->setMemoryBudgetMB(atoi(argv[2]))) {
+				debugPrintf("The budget must be a positive number of megabytes\n");
+				return true;
+			}
+		} else if (!strcmp(argv[1], "flush")) {
+			resourceManager->emptyCache();
+		} else {
+			debugPrintf("Usage: %s [budget <MB>|flush]\n", argv[0]);
+			return true;
+		}
+	}
+
+	debugPrintf("%d resources, %d KB of %d KB, %d queued for precaching\n", resourceManager->getResourceCount(),
+		resourceManager->getUsedMemory() / 1024, resourceManager->getMemoryBudget() / 1024,
+		resourceManager->getPrecacheQueueSize());
+	return true;
+}
+
 } // End of namespace Sword25
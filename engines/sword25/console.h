@@ -36,6 +36,13 @@ public:
 
 private:
 	Sword25Engine *_vm;
+
+	// Frame counters when the Lua profile was last started or reset
+	uint _profileFrameCount;
+	uint _profileScriptTime;
+
+	bool Cmd_LuaProfile(int argc, const char **argv);
+	bool Cmd_ResourceCache(int argc, const char **argv);
 };
 
 } // End of namespace Sword25
@@ -67,6 +67,13 @@ public:
 		return _pImage->getHeight();
 	}
 
+	/**
+	    @brief Returns the size of the decoded image in bytes. All images are stored with 32 bits per pixel.
+	*/
+	virtual uint getSize() const {
+		return _pImage ? _pImage->getWidth() * _pImage->getHeight() * 4 : 0;
+	}
+
 	/**
 	    @brief Rendert das Bild in den Framebuffer.
 	    @param PosX die Position auf der X-Achse im Zielbild in Pixeln, an der das Bild gerendert werden soll.<br>
@@ -70,6 +70,9 @@ GraphicEngine::GraphicEngine(Kernel *pKernel) :
 	_lastFrameDuration(0),
 	_timerActive(true),
 	_frameTimeSampleSlot(0),
+	_frameCount(0),
+	_scriptTime(0),
+	_renderEndTimeStamp(0),
 	_thumbnail(NULL),
 	ResourceService(pKernel) {
 	_frameTimeSamples.resize(FRAMETIME_SAMPLE_COUNT);
@@ -133,10 +136,20 @@ bool GraphicEngine::startFrame(bool updateAll) {
 	// Prepare the Layer Manager for the next frame
 	_renderObjectManagerPtr->startFrame();
 
+	// Load some of the resources the scripts asked to be precached
+	Kernel::getInstance()->getResourceManager()->update();
+
 	return true;
 }
 
 bool GraphicEngine::endFrame() {
+	// Everything since the previous frame was rendered happened in scripts
+	uint currentTime = Kernel::getInstance()->getMilliTicks();
+	if (_frameCount > 0)
+		_scriptTime += currentTime - _renderEndTimeStamp;
+	_frameCount++;
+	_renderEndTimeStamp = currentTime;
+
 #ifndef THEORA_INDIRECT_RENDERING
 	if (Kernel::getInstance()->getFMV()->isMovieLoaded())
 		return true;
@@ -146,6 +159,8 @@ bool GraphicEngine::endFrame() {
 
 	g_system->updateScreen();
 
+	_renderEndTimeStamp = Kernel::getInstance()->getMilliTicks();
+
 	return true;
 }
 
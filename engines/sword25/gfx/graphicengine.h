@@ -175,6 +175,22 @@ public:
 		return static_cast<float>(_lastFrameDuration) / 1000000.0f;
 	}
 
+	/**
+	 * Returns the number of frames ended so far
+	 */
+	uint getFrameCount() const {
+		return _frameCount;
+	}
+
+	/**
+	 * Returns the total time (in milliseconds) spent between the end of one frame
+	 * and the end of the next, not counting rendering. This is the time the
+	 * scripts and the engine functions they call took.
+	 */
+	uint getScriptTime() const {
+		return _scriptTime;
+	}
+
 	// Accessor methods
 
 	/**
@@ -309,6 +325,10 @@ private:
 	Common::Array<uint> _frameTimeSamples;
 	uint _frameTimeSampleSlot;
 
+	uint _frameCount;
+	uint _scriptTime;
+	uint _renderEndTimeStamp;
+
 private:
 	RenderObjectPtr<Panel> _mainPanelPtr;
 
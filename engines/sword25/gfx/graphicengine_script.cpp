@@ -344,13 +344,19 @@ static const luaL_reg GFX_FUNCTIONS[] = {
 	{0, 0}
 };
 
+static const char *const RENDEROBJECT_CLASS_NAMES[] = {
+	BITMAP_CLASS_NAME,
+	ANIMATION_CLASS_NAME,
+	PANEL_CLASS_NAME,
+	TEXT_CLASS_NAME,
+	0
+};
+
 static RenderObjectPtr<RenderObject> checkRenderObject(lua_State *L, bool errorIfRemoved = true) {
 	// Der erste Parameter muss vom Typ userdata sein und die Metatable einer Klasse haben, die von Gfx.RenderObject "erbt".
+	// Every render object method goes through here, so all classes are checked in one go.
 	uint *userDataPtr;
-	if ((userDataPtr = (uint *)LuaBindhelper::my_checkudata(L, 1, BITMAP_CLASS_NAME)) != 0 ||
-	        (userDataPtr = (uint *)LuaBindhelper::my_checkudata(L, 1, ANIMATION_CLASS_NAME)) != 0 ||
-	        (userDataPtr = (uint *)LuaBindhelper::my_checkudata(L, 1, PANEL_CLASS_NAME)) != 0 ||
-	        (userDataPtr = (uint *)LuaBindhelper::my_checkudata(L, 1, TEXT_CLASS_NAME)) != 0) {
+	if ((userDataPtr = (uint *)LuaBindhelper::my_checkudata(L, 1, RENDEROBJECT_CLASS_NAMES)) != 0) {
 		RenderObjectPtr<RenderObject> roPtr(*userDataPtr);
 		if (roPtr.isValid())
 			return roPtr;
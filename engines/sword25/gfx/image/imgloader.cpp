@@ -30,6 +30,8 @@
  */
 
 #include "common/memstream.h"
+#include "common/system.h"
+#include "sword25/sword25.h"	// for kDebugResource
 #include "sword25/gfx/image/image.h"
 #include "sword25/gfx/image/imgloader.h"
 #include "graphics/pixelformat.h"
@@ -40,20 +42,26 @@ namespace Sword25 {
 
 bool ImgLoader::decodePNGImage(const byte *fileDataPtr, uint fileSize, Graphics::Surface *dest) {
 	assert(dest);
-	Common::MemoryReadStream *fileStr = new Common::MemoryReadStream(fileDataPtr, fileSize, DisposeAfterUse::NO);
+	uint32 startTime = g_system->getMillis();
+	Common::MemoryReadStream fileStr(fileDataPtr, fileSize, DisposeAfterUse::NO);
 
 	::Image::PNGDecoder png;
-	if (!png.loadStream(*fileStr)) // the fileStr pointer, and thus pFileData will be deleted after this is done
+	if (!png.loadStream(fileStr))
 		error("Error while reading PNG image");
 
 	const Graphics::Surface *sourceSurface = png.getSurface();
-	Graphics::Surface *pngSurface = sourceSurface->convertTo(Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0), png.getPalette());
+	const Graphics::PixelFormat format(4, 8, 8, 8, 8, 24, 16, 8, 0);
 
-	dest->copyFrom(*pngSurface);
+	if (sourceSurface->format == format) {
+		dest->copyFrom(*sourceSurface);
+	} else {
+		// Take over the converted pixels instead of copying them once more
+		Graphics::Surface *pngSurface = sourceSurface->convertTo(format, png.getPalette());
+		*dest = *pngSurface;
+		delete pngSurface;
+	}
 
-	pngSurface->free();
-	delete pngSurface;
-	delete fileStr;
+	debugC(kDebugResource, "Decoded %dx%d PNG image in %d ms", dest->w, dest->h, g_system->getMillis() - startTime);
 
 	// Signal success
 	return true;
@@ -215,7 +215,7 @@ Common::Rect CalculateBoundingBox(const VectorImageElement &vectorImageElement)
 // Construction
 // -----------------------------------------------------------------------------
 
-VectorImage::VectorImage(const byte *pFileData, uint fileSize, bool &success, const Common::String &fname) : _pixelData(0), _fname(fname) {
+VectorImage::VectorImage(const byte *pFileData, uint fileSize, bool &success, const Common::String &fname) : _fname(fname) {
 	success = false;
 	_bgColor = 0;
 
@@ -312,7 +312,40 @@ VectorImage::~VectorImage() {
 			if (_elements[j].getPathInfo(i).getVec())
 				free(_elements[j].getPathInfo(i).getVec());
 
-	free(_pixelData);
+	clearRenderCache();
+}
+
+void VectorImage::clearRenderCache() {
+	for (uint i = 0; i < _renderCache.size(); i++)
+		free(_renderCache[i]._pixelData);
+
+	_renderCache.clear();
+}
+
+byte *VectorImage::getRenderedPixels(int width, int height) {
+	for (uint i = 0; i < _renderCache.size(); i++) {
+		if (_renderCache[i]._width == width && _renderCache[i]._height == height) {
+			// Move the hit to the front, so that the least recently used size gets evicted first
+			CachedRender hit = _renderCache[i];
+			_renderCache.remove_at(i);
+			_renderCache.insert_at(0, hit);
+
+			return hit._pixelData;
+		}
+	}
+
+	if (_renderCache.size() >= kMaxCachedRenders) {
+		free(_renderCache.back()._pixelData);
+		_renderCache.pop_back();
+	}
+
+	CachedRender entry;
+	entry._width = width;
+	entry._height = height;
+	entry._pixelData = render(width, height);
+	_renderCache.insert_at(0, entry);
+
+	return entry._pixelData;
 }
 
 
@@ -616,29 +649,20 @@ bool VectorImage::blit(int posX, int posY,
                        uint color,
                        int width, int height,
 					   RectangleList *updateRects) {
-	static VectorImage *oldThis = 0;
-	static int              oldWidth = -2;
-	static int              oldHeight = -2;
+	// A size of -1 means the unscaled image
+	if (width == -1)
+		width = getWidth();
+	if (height == -1)
+		height = getHeight();
 
 	// If width or height to 0, nothing needs to be shown.
-	if (width == 0 || height == 0)
+	if (width <= 0 || height <= 0)
 		return true;
 
-	// Determine if the old image in the cache can not be reused and must be recalculated
-	if (!(oldThis == this && oldWidth == width && oldHeight == height)) {
-		render(width, height);
-
-		oldThis = this;
-		oldHeight = height;
-		oldWidth = width;
-	}
-
-	RenderedImage *rend = new RenderedImage();
-
-	rend->replaceContent(_pixelData, width, height);
-	rend->blit(posX, posY, flipping, pPartRect, color, width, height, updateRects);
+	RenderedImage rend;
 
-	delete rend;
+	rend.replaceContent(getRenderedPixels(width, height), width, height);
+	rend.blit(posX, posY, flipping, pPartRect, color, width, height, updateRects);
 
 	return true;
 }
@@ -183,7 +183,11 @@ public:
 	}
 	virtual bool fill(const Common::Rect *pFillRect = 0, uint color = BS_RGB(0, 0, 0));
 
-	void render(int width, int height);
+	/**
+	 * Rasterizes the image at the given size.
+	 * @return a newly malloc()ed buffer of width * height 32-bit pixels, owned by the caller
+	 */
+	byte *render(int width, int height);
 
 	virtual uint getPixel(int x, int y);
 	virtual bool isBlitSource() const {
@@ -225,7 +229,24 @@ private:
 	Common::Array<VectorImageElement>    _elements;
 	Common::Rect                         _boundingBox;
 
-	byte *_pixelData;
+	/**
+	 * Number of rasterized sizes kept per image. Scaled objects and the
+	 * animation frames sharing a shape tend to alternate between a couple of
+	 * sizes, so keeping more than one avoids rasterizing on every blit.
+	 */
+	static const uint kMaxCachedRenders = 2;
+
+	struct CachedRender {
+		int _width;
+		int _height;
+		byte *_pixelData;
+	};
+
+	/** Rasterized versions of the image, most recently used first. */
+	Common::Array<CachedRender> _renderCache;
+
+	byte *getRenderedPixels(int width, int height);
+	void clearRenderCache();
 
 	Common::String _fname;
 	uint _bgColor;
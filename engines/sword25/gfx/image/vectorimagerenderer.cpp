@@ -38,6 +38,8 @@
  *
  */
 
+#include "common/system.h"
+#include "sword25/sword25.h"	// for kDebugResource
 #include "sword25/gfx/image/art.h"
 #include "sword25/gfx/image/vectorimage.h"
 #include "graphics/colormasks.h"
@@ -59,29 +61,23 @@ void art_rgb_fill_run1(byte *buf, byte r, byte g, byte b, int n) {
 }
 
 void art_rgb_run_alpha1(byte *buf, byte r, byte g, byte b, int alpha, int n) {
-	int i;
-	int v;
-
-	for (i = 0; i < n; i++) {
-#if defined(SCUMM_LITTLE_ENDIAN)
-		v = *buf;
-		*buf++ = MIN(v + alpha, 0xff);
-		v = *buf;
-		*buf++ = v + (((b - v) * alpha + 0x80) >> 8);
-		v = *buf;
-		*buf++ = v + (((g - v) * alpha + 0x80) >> 8);
-		v = *buf;
-		*buf++ = v + (((r - v) * alpha + 0x80) >> 8);
-#else
-		v = *buf;
-		*buf++ = v + (((r - v) * alpha + 0x80) >> 8);
-		v = *buf;
-		*buf++ = v + (((g - v) * alpha + 0x80) >> 8);
-		v = *buf;
-		*buf++ = v + (((b - v) * alpha + 0x80) >> 8);
-		v = *buf;
-		*buf++ = MIN(v + alpha, 0xff);
-#endif
+	// Pixels are stored as native 32-bit words with red in the top byte and
+	// alpha in the bottom one. Each colour channel is blended as
+	// (v * (256 - alpha) + c * alpha + 0x80) >> 8, which equals
+	// v + (((c - v) * alpha + 0x80) >> 8) for alpha <= 256 and never exceeds
+	// 16 bits. So red and blue, which are 16 bits apart, can be blended with
+	// a single multiplication without the lanes carrying into each other.
+	const uint32 invAlpha = 256 - alpha;
+	const uint32 rbColor = ((r * alpha + 0x80) << 16) | (b * alpha + 0x80);
+	const uint32 gColor = g * alpha + 0x80;
+	uint32 *pixel = (uint32 *)buf;
+
+	for (int i = 0; i < n; i++) {
+		uint32 v = *pixel;
+		uint32 rb = (((v >> 8) & 0x00ff00ff) * invAlpha + rbColor) & 0xff00ff00;
+		uint32 gr = ((((v >> 16) & 0xff) * invAlpha + gColor) & 0xff00) << 8;
+		uint32 a = MIN<uint32>((v & 0xff) + alpha, 0xff);
+		*pixel++ = rb | gr | a;
 	}
 }
 
@@ -400,17 +396,16 @@ void drawBez(ArtBpath *bez1, ArtBpath *bez2, byte *buffer, int width, int height
 	free(vec);
 }
 
-void VectorImage::render(int width, int height) {
-	double scaleX = (width == - 1) ? 1 : static_cast<double>(width) / static_cast<double>(getWidth());
-	double scaleY = (height == - 1) ? 1 : static_cast<double>(height) / static_cast<double>(getHeight());
+byte *VectorImage::render(int width, int height) {
+	double scaleX = static_cast<double>(width) / static_cast<double>(getWidth());
+	double scaleY = static_cast<double>(height) / static_cast<double>(getHeight());
 
 	debug(3, "VectorImage::render(%d, %d) %s", width, height, _fname.c_str());
 
-	if (_pixelData)
-		free(_pixelData);
+	uint32 startTime = g_system->getMillis();
 
-	_pixelData = (byte *)malloc(width * height * 4);
-	memset(_pixelData, 0, width * height * 4);
+	byte *pixelData = (byte *)malloc(width * height * 4);
+	memset(pixelData, 0, width * height * 4);
 
 	for (uint e = 0; e < _elements.size(); e++) {
 
@@ -451,7 +446,7 @@ void VectorImage::render(int width, int height) {
 			(*fill0pos).code = ART_END;
 			(*fill1pos).code = ART_END;
 
-			drawBez(fill1, fill0, _pixelData, width, height, _boundingBox.left, _boundingBox.top, scaleX, scaleY, -1, _elements[e].getFillStyleColor(s));
+			drawBez(fill1, fill0, pixelData, width, height, _boundingBox.left, _boundingBox.top, scaleX, scaleY, -1, _elements[e].getFillStyleColor(s));
 
 			free(fill0);
 			free(fill1);
@@ -464,11 +459,15 @@ void VectorImage::render(int width, int height) {
 
 			for (uint p = 0; p < _elements[e].getPathCount(); p++) {
 				if (_elements[e].getPathInfo(p).getLineStyle() == s + 1) {
-					drawBez(_elements[e].getPathInfo(p).getVec(), 0, _pixelData, width, height, _boundingBox.left, _boundingBox.top, scaleX, scaleY, penWidth, _elements[e].getLineStyleColor(s));
+					drawBez(_elements[e].getPathInfo(p).getVec(), 0, pixelData, width, height, _boundingBox.left, _boundingBox.top, scaleX, scaleY, penWidth, _elements[e].getLineStyleColor(s));
 				}
 			}
 		}
 	}
+
+	debugC(kDebugResource, "Rasterized %s at %dx%d in %d ms", _fname.c_str(), width, height, g_system->getMillis() - startTime);
+
+	return pixelData;
 }
 
 
@@ -310,11 +310,7 @@ static int precacheResource(lua_State *L) {
 	ResourceManager *pResource = pKernel->getResourceManager();
 	assert(pResource);
 
-#ifdef PRECACHE_RESOURCES
-	lua_pushbooleancpp(L, pResource->precacheResource(luaL_checkstring(L, 1)));
-#else
-	lua_pushbooleancpp(L, true);
-#endif
+	lua_pushbooleancpp(L, pResource->queuePrecache(luaL_checkstring(L, 1)));
 
 	return 1;
 }
@@ -325,11 +321,7 @@ static int forcePrecacheResource(lua_State *L) {
 	ResourceManager *pResource = pKernel->getResourceManager();
 	assert(pResource);
 
-#ifdef PRECACHE_RESOURCES
-	lua_pushbooleancpp(L, pResource->precacheResource(luaL_checkstring(L, 1), true));
-#else
-	lua_pushbooleancpp(L, true);
-#endif
+	lua_pushbooleancpp(L, pResource->queuePrecache(luaL_checkstring(L, 1), true));
 
 	return 1;
 }
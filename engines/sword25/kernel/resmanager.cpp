@@ -29,6 +29,9 @@
  *
  */
 
+#include "common/config-manager.h"
+#include "common/system.h"
+
 #include "sword25/sword25.h"	// for kDebugResource
 #include "sword25/kernel/resmanager.h"
 #include "sword25/kernel/resource.h"
@@ -37,17 +40,35 @@
 
 namespace Sword25 {
 
-// Sets the amount of resources that are simultaneously loaded.
-// This needs to be a relatively high number, as all the animation
-// frames in each scene are loaded as separate resources.
-// Also, George's walk states are all loaded here (150 files)
-#define SWORD25_RESOURCECACHE_MIN 400
-// The maximum number of loaded resources. If more than these resources
-// are loaded, the resource manager will start purging resources till it
-// hits the minimum limit above
-#define SWORD25_RESOURCECACHE_MAX 500
+// The default amount of memory the loaded resources may occupy, which can be
+// overridden with the "resource_cache_mb" config key. This needs to be a
+// relatively high number, as all the animation frames in each scene are
+// loaded as separate resources. Also, George's walk states are all loaded
+// here (150 files)
+#define SWORD25_RESOURCECACHE_BUDGET (96 * 1024 * 1024)
+// When the budget is exceeded, the resource manager purges resources till
+// usage falls to this percentage of it
+#define SWORD25_RESOURCECACHE_LOW_PERCENT 80
+// Every resource is accounted at least this many bytes, so that many small
+// resources still count against the budget
+#define SWORD25_RESOURCE_OVERHEAD 1024
+// The largest budget that can be configured, in megabytes. Larger values would
+// overflow the byte count
+#define SWORD25_RESOURCECACHE_MAX_MB 2048
+// The time in milliseconds update() may spend loading queued resources per frame
+#define SWORD25_PRECACHE_TIME_SLICE 5
+
+ResourceManager::ResourceManager(Kernel *pKernel) :
+	_kernelPtr(pKernel),
+	_usedMemory(0) {
+	if (!ConfMan.hasKey("resource_cache_mb") || !setMemoryBudgetMB(ConfMan.getInt("resource_cache_mb")))
+		setMemoryBudget(SWORD25_RESOURCECACHE_BUDGET);
+}
 
 ResourceManager::~ResourceManager() {
+	_precacheQueue.clear();
+	_precacheQueued.clear();
+
 	// Clear all unlocked resources
 	emptyCache();
 
@@ -82,15 +103,29 @@ bool ResourceManager::registerResourceService(ResourceService *pService) {
 	return true;
 }
 
+void ResourceManager::setMemoryBudget(uint bytes) {
+	_maxMemory = bytes;
+	_minMemory = bytes / 100 * SWORD25_RESOURCECACHE_LOW_PERCENT;
+	debugC(kDebugResource, "Resource cache budget set to %d KB", _maxMemory / 1024);
+}
+
+bool ResourceManager::setMemoryBudgetMB(int megabytes) {
+	if (megabytes <= 0)
+		return false;
+
+	setMemoryBudget(MIN(megabytes, SWORD25_RESOURCECACHE_MAX_MB) * 1024u * 1024u);
+	return true;
+}
+
 /**
  * Deletes resources as necessary until the specified memory limit is not being exceeded.
  */
 void ResourceManager::deleteResourcesIfNecessary() {
 	// If enough memory is available, or no resources are loaded, then the function can immediately end
-	if (_resources.size() < SWORD25_RESOURCECACHE_MAX)
+	if (_usedMemory <= _maxMemory || _resources.empty())
 		return;
 
-	// Keep deleting resources until the memory usage of the process falls below the set maximum limit.
+	// Keep deleting resources until the memory usage falls below the low water mark.
 	// The list is processed backwards in order to first release those resources that have been
 	// not been accessed for the longest
 	Common::List<Resource *>::iterator iter = _resources.end();
@@ -100,14 +135,15 @@ void ResourceManager::deleteResourcesIfNecessary() {
 		// The resource may be released only if it isn't locked
 		if ((*iter)->getLockCount() == 0)
 			iter = deleteResource(*iter);
-	} while (iter != _resources.begin() && _resources.size() >= SWORD25_RESOURCECACHE_MIN);
+	} while (iter != _resources.begin() && _usedMemory > _minMemory);
 
-	// Are we still above the minimum? If yes, then start releasing locked resources
+	// Is the budget still exceeded? If yes, then start releasing locked resources
 	// FIXME: This code shouldn't be needed at all, but it seems like there is a bug
 	// in the resource lock code, and resources are not unlocked when changing rooms.
 	// Only image/animation resources are unlocked forcibly, thus this shouldn't have
-	// any impact on the game itself.
-	if (_resources.size() <= SWORD25_RESOURCECACHE_MIN)
+	// any impact on the game itself. As it is a last resort, it only kicks in when
+	// the budget itself, not just the low water mark, is exceeded.
+	if (_usedMemory <= _maxMemory || _resources.empty())
 		return;
 
 	iter = _resources.end();
@@ -126,7 +162,7 @@ void ResourceManager::deleteResourcesIfNecessary() {
 
 			iter = deleteResource(*iter);
 		}
-	} while (iter != _resources.begin() && _resources.size() >= SWORD25_RESOURCECACHE_MIN);
+	} while (iter != _resources.begin() && _usedMemory > _minMemory);
 }
 
 /**
@@ -220,6 +256,65 @@ bool ResourceManager::precacheResource(const Common::String &fileName, bool forc
 
 #endif
 
+bool ResourceManager::queuePrecache(const Common::String &fileName, bool forceReload) {
+	// Get the absolute path to the file
+	Common::String uniqueFileName = getUniqueFileName(fileName);
+	if (uniqueFileName.empty())
+		return false;
+
+	if (!findResourceService(uniqueFileName)) {
+		// This isn't fatal - e.g. it can happen when loading saved games
+		debugC(kDebugResource, "Could not precache \"%s\",", fileName.c_str());
+		return false;
+	}
+
+	// Already loaded resources only need to be queued to be reloaded
+	if (!forceReload && getResource(uniqueFileName))
+		return true;
+
+	PrecacheSet::iterator it = _precacheQueued.find(uniqueFileName);
+	if (it != _precacheQueued.end()) {
+		it->_value = it->_value || forceReload;
+		return true;
+	}
+
+	PrecacheRequest request;
+	request._fileName = uniqueFileName;
+	request._forceReload = forceReload;
+	_precacheQueue.push_back(request);
+	_precacheQueued[uniqueFileName] = forceReload;
+
+	return true;
+}
+
+void ResourceManager::update() {
+	if (_precacheQueue.empty())
+		return;
+
+	// Always load at least one resource, so the queue drains even on slow frames
+	uint startTime = g_system->getMillis();
+	do {
+		PrecacheRequest request = _precacheQueue.front();
+		_precacheQueue.pop_front();
+		bool forceReload = _precacheQueued[request._fileName];
+		_precacheQueued.erase(request._fileName);
+
+		Resource *pResource = getResource(request._fileName);
+		if (forceReload && pResource) {
+			if (pResource->getLockCount()) {
+				// The game may well have requested the resource itself before the queue got to it
+				debugC(kDebugResource, "Could not force precaching of \"%s\". The resource is locked.", request._fileName.c_str());
+				continue;
+			}
+			deleteResource(pResource);
+			pResource = 0;
+		}
+
+		if (!pResource)
+			loadResource(request._fileName);
+	} while (!_precacheQueue.empty() && g_system->getMillis() - startTime < SWORD25_PRECACHE_TIME_SLICE);
+}
+
 /**
  * Moves a resource to the top of the resource list
  * @param pResource     The resource
@@ -241,31 +336,43 @@ void ResourceManager::moveToFront(Resource *pResource) {
  */
 Resource *ResourceManager::loadResource(const Common::String &fileName) {
 	// ResourceService finden, der die Resource laden kann.
-	for (uint i = 0; i < _resourceServices.size(); ++i) {
-		if (_resourceServices[i]->canLoadResource(fileName)) {
-			// If more memory is desired, memory must be released
-			deleteResourcesIfNecessary();
-
-			// Load the resource
-			Resource *pResource = _resourceServices[i]->loadResource(fileName);
-			if (!pResource) {
-				error("Responsible service could not load resource \"%s\".", fileName.c_str());
-				return NULL;
-			}
+	ResourceService *pService = findResourceService(fileName);
+	if (!pService) {
+		// This isn't fatal - e.g. it can happen when loading saved games
+		debugC(kDebugResource, "Could not find a service that can load \"%s\".", fileName.c_str());
+		return NULL;
+	}
 
-			// Add the resource to the front of the list
-			_resources.push_front(pResource);
-			pResource->_iterator = _resources.begin();
+	// If more memory is desired, memory must be released
+	deleteResourcesIfNecessary();
 
-			// Also store the resource in the hash table for quick lookup
-			_resourceHashMap[pResource->getFileName()] = pResource;
+	// Load the resource
+	Resource *pResource = pService->loadResource(fileName);
+	if (!pResource) {
+		error("Responsible service could not load resource \"%s\".", fileName.c_str());
+		return NULL;
+	}
 
-			return pResource;
-		}
+	// Add the resource to the front of the list
+	_resources.push_front(pResource);
+	pResource->_iterator = _resources.begin();
+
+	// Also store the resource in the hash table for quick lookup
+	_resourceHashMap[pResource->getFileName()] = pResource;
+
+	// Remember what was accounted, so that exactly this is given back on deletion
+	pResource->_cacheSize = pResource->getSize() + SWORD25_RESOURCE_OVERHEAD;
+	_usedMemory += pResource->_cacheSize;
+
+	return pResource;
+}
+
+ResourceService *ResourceManager::findResourceService(const Common::String &uniqueFileName) const {
+	for (uint i = 0; i < _resourceServices.size(); ++i) {
+		if (_resourceServices[i]->canLoadResource(uniqueFileName))
+			return _resourceServices[i];
 	}
 
-	// This isn't fatal - e.g. it can happen when loading saved games
-	debugC(kDebugResource, "Could not find a service that can load \"%s\".", fileName.c_str());
 	return NULL;
 }
 
@@ -295,6 +402,7 @@ Common::String ResourceManager::getUniqueFileName(const Common::String &fileName
 Common::List<Resource *>::iterator ResourceManager::deleteResource(Resource *pResource) {
 	// Remove the resource from the hash table
 	_resourceHashMap.erase(pResource->_fileName);
+	_usedMemory -= pResource->_cacheSize;
 
 	// Delete the resource from the resource list
 	Common::List<Resource *>::iterator result = _resources.erase(pResource->_iterator);
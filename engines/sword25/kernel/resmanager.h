@@ -66,6 +66,53 @@ public:
 	bool precacheResource(const Common::String &fileName, bool forceReload = false);
 #endif
 
+	/**
+	 * Queues a resource to be loaded into the cache in the background.
+	 * Queued resources are loaded a few at a time between frames by update(), so
+	 * precaching a whole room doesn't stall the game. A resource requested before
+	 * its turn comes is simply loaded right away.
+	 * @param FileName      The filename of the resource to be cached
+	 * @param ForceReload   Indicates whether the file should be reloaded if it's already in the cache.
+	 * @return              Returns false if the resource can't be loaded by any service.
+	 */
+	bool queuePrecache(const Common::String &fileName, bool forceReload = false);
+
+	/**
+	 * Loads queued resources until the time slice for this frame is used up
+	 */
+	void update();
+
+	/**
+	 * Sets the memory the cached resources may occupy. When it is exceeded, unlocked
+	 * resources are released, least recently used first, until usage falls well below it.
+	 * @param Bytes         The budget in bytes
+	 */
+	void setMemoryBudget(uint bytes);
+
+	/**
+	 * Sets the memory budget in megabytes, as given by the user. Values above
+	 * the supported maximum are clamped.
+	 * @param Megabytes     The budget in megabytes
+	 * @return false if the value is not a positive number, the budget is unchanged then
+	 */
+	bool setMemoryBudgetMB(int megabytes);
+
+	uint getMemoryBudget() const {
+		return _maxMemory;
+	}
+
+	uint getUsedMemory() const {
+		return _usedMemory;
+	}
+
+	uint getResourceCount() const {
+		return _resourceHashMap.size();
+	}
+
+	uint getPrecacheQueueSize() const {
+		return _precacheQueue.size();
+	}
+
 	/**
 	 * Registers a RegisterResourceService. This method is the constructor of
 	 * BS_ResourceService, and thus helps all resource services in the ResourceManager list
@@ -93,9 +140,7 @@ private:
 	 * Creates a new resource manager
 	 * Only the BS_Kernel class can generate copies this class. Thus, the constructor is private
 	 */
-	ResourceManager(Kernel *pKernel) :
-		_kernelPtr(pKernel)
-	{}
+	ResourceManager(Kernel *pKernel);
 	virtual ~ResourceManager();
 
 	/**
@@ -134,11 +179,28 @@ private:
 	 */
 	void deleteResourcesIfNecessary();
 
+	/**
+	 * Returns the service that can load the given resource, or NULL if there is none
+	 */
+	ResourceService *findResourceService(const Common::String &uniqueFileName) const;
+
 	Kernel *_kernelPtr;
 	Common::Array<ResourceService *> _resourceServices;
 	Common::List<Resource *> _resources;
 	typedef Common::HashMap<Common::String, Resource *> ResMap;
 	ResMap _resourceHashMap;
+
+	uint _usedMemory;
+	uint _maxMemory;
+	uint _minMemory;
+
+	struct PrecacheRequest {
+		Common::String _fileName;
+		bool _forceReload;
+	};
+	Common::List<PrecacheRequest> _precacheQueue;
+	typedef Common::HashMap<Common::String, bool> PrecacheSet;
+	PrecacheSet _precacheQueued;
 };
 
 } // End of namespace Sword25
@@ -37,7 +37,8 @@ namespace Sword25 {
 
 Resource::Resource(const Common::String &fileName, RESOURCE_TYPES type) :
 	_type(type),
-	_refCount(0) {
+	_refCount(0),
+	_cacheSize(0) {
 	PackageManager *pPM = Kernel::getInstance()->getPackage();
 	assert(pPM);
 
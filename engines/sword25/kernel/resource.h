@@ -92,6 +92,15 @@ public:
 		return _type;
 	}
 
+	/**
+	 * Returns the number of bytes the resource's decoded data occupies in memory,
+	 * or 0 if it is negligible. Used by the resource manager to keep the cache
+	 * within its memory budget.
+	 */
+	virtual uint getSize() const {
+		return 0;
+	}
+
 protected:
 	virtual ~Resource() {}
 
@@ -99,6 +108,7 @@ private:
 	Common::String _fileName;          ///< The absolute filename
 	uint _refCount;          ///< The number of locks
 	uint _type;              ///< The type of the resource
+	uint _cacheSize;         ///< The memory accounted to the resource by the resource manager
 	Common::List<Resource *>::iterator _iterator;        ///< Points to the resource position in the LRU list
 };
 
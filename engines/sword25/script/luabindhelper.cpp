@@ -302,16 +302,26 @@ bool LuaBindhelper::getMetatable(lua_State *L, const Common::String &tableName)
 
 // Like luaL_checkudata, only without that no error is generated.
 void *LuaBindhelper::my_checkudata(lua_State *L, int ud, const char *tname) {
+	const char *const tnames[] = { tname, 0 };
+	return my_checkudata(L, ud, tnames);
+}
+
+void *LuaBindhelper::my_checkudata(lua_State *L, int ud, const char *const *tnames) {
 	int top = lua_gettop(L);
 
 	void *p = lua_touserdata(L, ud);
 	if (p != NULL) { /* value is a userdata? */
 		if (lua_getmetatable(L, ud)) { /* does it have a metatable? */
-			// lua_getfield(L, LUA_REGISTRYINDEX, tname);  /* get correct metatable */
-			LuaBindhelper::getMetatable(L, tname);
-			if (lua_rawequal(L, -1, -2)) { /* does it have the correct mt? */
-				lua_settop(L, top);
-				return p;
+			// A class that was never registered has no metatable yet, and can't
+			// match, so there is no need to create it as getMetatable() would
+			pushMetatableTable(L);
+			for (; *tnames; ++tnames) {
+				lua_getfield(L, -1, *tnames);
+				if (lua_rawequal(L, -1, -3)) { /* does it have the correct mt? */
+					lua_settop(L, top);
+					return p;
+				}
+				lua_pop(L, 1);
 			}
 		}
 	}
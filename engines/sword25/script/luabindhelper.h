@@ -109,6 +109,14 @@ public:
 
 	static void *my_checkudata(lua_State *L, int ud, const char *tname);
 
+	/**
+	 * Like my_checkudata(), but accepts userdata of any of several classes.
+	 * Cheaper than trying the classes one by one, as the metatables are only
+	 * looked up once.
+	 * @param tnames        The class names, terminated with a null pointer
+	 */
+	static void *my_checkudata(lua_State *L, int ud, const char *const *tnames);
+
 private:
 	static bool createTable(lua_State *L, const Common::String &tableName);
 };
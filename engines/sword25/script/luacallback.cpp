@@ -41,15 +41,24 @@ const char *CALLBACKTABLE_NAME = "__CALLBACKS";
 
 namespace Sword25 {
 
-LuaCallback::LuaCallback(lua_State *L) {
+uint LuaCallback::_generation = 0;
+
+LuaCallback::LuaCallback(lua_State *L) : _callbackTableRef(LUA_NOREF), _callbackTableGeneration(0) {
 	// Create callback table
 	lua_newtable(L);
 	lua_setglobal(L, CALLBACKTABLE_NAME);
+
+	// Other callbacks may have cached the table this one just replaced
+	invalidateReferences();
 }
 
 LuaCallback::~LuaCallback() {
 }
 
+void LuaCallback::invalidateReferences() {
+	_generation++;
+}
+
 void LuaCallback::registerCallbackFunction(lua_State *L, uint objectHandle) {
 	assert(lua_isfunction(L, -1));
 	ensureObjectCallbackTableExists(L, objectHandle);
@@ -153,15 +162,25 @@ void LuaCallback::ensureObjectCallbackTableExists(lua_State *L, uint objectHandl
 }
 
 void LuaCallback::pushCallbackTable(lua_State *L) {
+	if (_callbackTableRef != LUA_NOREF && _callbackTableGeneration == _generation) {
+		lua_rawgeti(L, LUA_REGISTRYINDEX, _callbackTableRef);
+		return;
+	}
+
+	// The global has been replaced since the table was last looked up, take a new reference
+	luaL_unref(L, LUA_REGISTRYINDEX, _callbackTableRef);
 	lua_getglobal(L, CALLBACKTABLE_NAME);
+	lua_pushvalue(L, -1);
+	_callbackTableRef = luaL_ref(L, LUA_REGISTRYINDEX);
+	_callbackTableGeneration = _generation;
 }
 
 void LuaCallback::pushObjectCallbackTable(lua_State *L, uint objectHandle) {
 	pushCallbackTable(L);
 
-	// Push Object Callback table onto the stack
-	lua_pushnumber(L, objectHandle);
-	lua_gettable(L, -2);
+	// Push Object Callback table onto the stack. Handles are integers and the
+	// table has no metatable, so a raw lookup finds the same entry.
+	lua_rawgeti(L, -1, objectHandle);
 
 	// Pop the callback table from the stack
 	lua_remove(L, -2);
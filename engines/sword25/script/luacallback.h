@@ -53,6 +53,12 @@ public:
 
 	void invokeCallbackFunctions(lua_State *L, uint objectHandle);
 
+	/**
+	 * Must be called whenever the callback table global may have been replaced,
+	 * such as after the Lua state was unpersisted.
+	 */
+	static void invalidateReferences();
+
 protected:
 	virtual int preFunctionInvokation(lua_State *L) {
 		return 0;
@@ -62,6 +68,11 @@ private:
 	void ensureObjectCallbackTableExists(lua_State *L, uint objectHandle);
 	void pushCallbackTable(lua_State *L);
 	void pushObjectCallbackTable(lua_State *L, uint objectHandle);
+
+	// Registry reference to the callback table, so it isn't looked up by name on every call
+	int _callbackTableRef;
+	uint _callbackTableGeneration;
+	static uint _generation;
 };
 
 } // End of namespace Sword25
@@ -29,6 +29,7 @@
  *
  */
 
+#include "common/algorithm.h"
 #include "common/memstream.h"
 #include "common/debug-channels.h"
 
@@ -36,6 +37,7 @@
 #include "sword25/package/packagemanager.h"
 #include "sword25/script/luascript.h"
 #include "sword25/script/luabindhelper.h"
+#include "sword25/script/luacallback.h"
 
 #include "sword25/kernel/outputpersistenceblock.h"
 #include "sword25/kernel/inputpersistenceblock.h"
@@ -50,7 +52,10 @@ namespace Sword25 {
 LuaScriptEngine::LuaScriptEngine(Kernel *KernelPtr) :
 	ScriptEngine(KernelPtr),
 	_state(0),
-	_pcallErrorhandlerRegistryIndex(0) {
+	_pcallErrorhandlerRegistryIndex(0),
+	_debugHookMask(0),
+	_profiling(false),
+	_profileSampleCount(0) {
 }
 
 LuaScriptEngine::~LuaScriptEngine() {
@@ -124,6 +129,7 @@ bool LuaScriptEngine::init() {
 
 		if (mask != 0)
 			lua_sethook(_state, debugHook, mask, 0);
+		_debugHookMask = mask;
 	}
 
 	debugC(kDebugScript, "Lua initialized.");
@@ -131,6 +137,55 @@ bool LuaScriptEngine::init() {
 	return true;
 }
 
+void LuaScriptEngine::startProfiling(uint interval) {
+	// Lua has a single hook, so this replaces the debug hook until profiling stops
+	lua_sethook(_state, profileHook, LUA_MASKCOUNT, MAX<uint>(interval, 1));
+	_profiling = true;
+}
+
+void LuaScriptEngine::stopProfiling() {
+	if (!_profiling)
+		return;
+
+	if (_debugHookMask != 0)
+		lua_sethook(_state, debugHook, _debugHookMask, 0);
+	else
+		lua_sethook(_state, 0, 0, 0);
+	_profiling = false;
+}
+
+void LuaScriptEngine::resetProfile() {
+	_profileSamples.clear();
+	_profileSampleCount = 0;
+}
+
+namespace {
+bool compareProfileEntries(const LuaScriptEngine::ProfileEntry &a, const LuaScriptEngine::ProfileEntry &b) {
+	return a._samples > b._samples;
+}
+}
+
+void LuaScriptEngine::getProfile(Common::Array<ProfileEntry> &entries) const {
+	entries.clear();
+	for (Common::HashMap<Common::String, uint>::const_iterator it = _profileSamples.begin(); it != _profileSamples.end(); ++it) {
+		ProfileEntry entry;
+		entry._function = it->_key;
+		entry._samples = it->_value;
+		entries.push_back(entry);
+	}
+	Common::sort(entries.begin(), entries.end(), compareProfileEntries);
+}
+
+void LuaScriptEngine::profileHook(lua_State *L, lua_Debug *ar) {
+	if (!lua_getinfo(L, "Sn", ar))
+		return;
+
+	LuaScriptEngine *engine = static_cast<LuaScriptEngine *>(Kernel::getInstance()->getScript());
+	Common::String function = Common::String::format("%s (%s:%d)", ar->name ? ar->name : "?", ar->short_src, ar->linedefined);
+	engine->_profileSamples[function]++;
+	engine->_profileSampleCount++;
+}
+
 bool LuaScriptEngine::executeFile(const Common::String &fileName) {
 #ifdef DEBUG
 	int __startStackDepth = lua_gettop(_state);
@@ -509,6 +564,9 @@ bool LuaScriptEngine::unpersist(InputPersistenceBlock &reader) {
 	// Force garbage collection
 	lua_gc(_state, LUA_GCCOLLECT, 0);
 
+	// The callback table was replaced along with the other globals
+	LuaCallback::invalidateReferences();
+
 	return true;
 }
 
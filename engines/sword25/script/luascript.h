@@ -32,12 +32,16 @@
 #ifndef SWORD25_LUASCRIPT_H
 #define SWORD25_LUASCRIPT_H
 
+#include "common/array.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 #include "common/str.h"
 #include "common/str-array.h"
 #include "sword25/kernel/common.h"
 #include "sword25/script/script.h"
 
 struct lua_State;
+struct lua_Debug;
 
 namespace Sword25 {
 
@@ -93,10 +97,42 @@ public:
 	 */
 	virtual bool unpersist(InputPersistenceBlock &reader);
 
+	struct ProfileEntry {
+		Common::String _function;
+		uint _samples;
+	};
+
+	/**
+	 * Starts sampling which Lua function is running, once every interval VM
+	 * instructions. The debug hook is suspended while profiling.
+	 */
+	void startProfiling(uint interval = DEFAULT_PROFILE_INTERVAL);
+	void stopProfiling();
+	bool isProfiling() const {
+		return _profiling;
+	}
+	void resetProfile();
+	/**
+	 * Returns the sampled functions, most sampled first
+	 */
+	void getProfile(Common::Array<ProfileEntry> &entries) const;
+	uint getProfileSampleCount() const {
+		return _profileSampleCount;
+	}
+
+	static const uint DEFAULT_PROFILE_INTERVAL = 1000;
+
 private:
 	lua_State *_state;
 	int _pcallErrorhandlerRegistryIndex;
 
+	int _debugHookMask;
+	bool _profiling;
+	uint _profileSampleCount;
+	Common::HashMap<Common::String, uint> _profileSamples;
+
+	static void profileHook(lua_State *L, lua_Debug *ar);
+
 	bool registerStandardLibs();
 	bool registerStandardLibExtensions();
 	bool executeBuffer(const byte *data, uint size, const Common::String &name) const;
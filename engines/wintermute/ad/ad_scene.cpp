@@ -59,6 +59,7 @@
 #include "engines/wintermute/ui/ui_window.h"
 #include "engines/wintermute/utils/utils.h"
 #include "engines/wintermute/wintermute.h"
+#include "common/algorithm.h"
 #include <limits.h>
 
 namespace Wintermute {
@@ -90,6 +91,13 @@ void AdScene::setDefaults() {
 	_mainLayer = nullptr;
 
 	_pfPointsNum = 0;
+	_pfGridRect.setEmpty();
+	_pfGridSignature = 0;
+	_pfGridValid = false;
+	_pfGridTooLarge = false;
+	_pfSearchSignature = 0;
+	_pfSearchValid = false;
+	_pfHeapValid = false;
 	_persistentState = false;
 	_persistentStateSprites = true;
 
@@ -175,6 +183,11 @@ void AdScene::cleanup() {
 	}
 	_pfPath.clear();
 	_pfPointsNum = 0;
+	_pfWalkGrid.clear();
+	_pfSearchGrid.clear();
+	_pfSearchRects.clear();
+	_pfSearchValid = false;
+	_pfHeap.clear();
 
 	for (uint32 i = 0; i < _objects.size(); i++) {
 		_gameRef->unregisterObject(_objects[i]);
@@ -203,6 +216,8 @@ bool AdScene::getPath(const BasePoint &source, const BasePoint &target, AdPath *
 
 		// prepare working path
 		pfPointsStart();
+		_pfHeap.clear();
+		_pfHeapValid = false;
 
 		// first point
 		//_pfPath.add(new AdPathPoint(source.x, source.y, 0));
@@ -421,6 +436,15 @@ bool AdScene::isWalkableAt(int x, int y, bool checkFreeObjects, BaseObject *requ
 
 //////////////////////////////////////////////////////////////////////////
 int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject *requester) {
+	return getPointsDist(p1, p2, requester, false);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject *requester, bool useGrid) {
+	// The grid already has the requester's view of the free objects in it
+	useGrid = useGrid && !_pfGridTooLarge;
+
 	double xStep, yStep, x, y;
 	int xLength, yLength, xCount, yCount;
 	int x1, y1, x2, y2;
@@ -443,7 +467,7 @@ int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject
 		y = y1;
 
 		for (xCount = x1; xCount < x2; xCount++) {
-			if (isBlockedAt(xCount, (int)y, true, requester)) {
+			if (useGrid ? pfIsBlockedInGrid(xCount, (int)y) : isBlockedAt(xCount, (int)y, true, requester)) {
 				return -1;
 			}
 			y += yStep;
@@ -458,7 +482,7 @@ int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject
 		x = x1;
 
 		for (yCount = y1; yCount < y2; yCount++) {
-			if (isBlockedAt((int)x, yCount, true, requester)) {
+			if (useGrid ? pfIsBlockedInGrid((int)x, yCount) : isBlockedAt((int)x, yCount, true, requester)) {
 				return -1;
 			}
 			x += xStep;
@@ -470,16 +494,20 @@ int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject
 
 //////////////////////////////////////////////////////////////////////////
 void AdScene::pathFinderStep() {
-	int i;
+	if (!_pfHeapValid) {
+		pfHeapRebuild();
+	}
+
 	// get lowest unmarked
-	int lowestDist = INT_MAX;
 	AdPathPoint *lowestPt = nullptr;
-
-	for (i = 0; i < _pfPointsNum; i++)
-		if (!_pfPath[i]->_marked && _pfPath[i]->_distance < lowestDist) {
-			lowestDist = _pfPath[i]->_distance;
-			lowestPt = _pfPath[i];
+	while (!_pfHeap.empty()) {
+		PfHeapEntry entry = pfHeapPop();
+		AdPathPoint *point = _pfPath[entry._index];
+		if (!point->_marked && point->_distance == entry._distance) {
+			lowestPt = point;
+			break;
 		}
+	}
 
 	if (lowestPt == nullptr) { // no path -> terminate PathFinder
 		_pfReady = true;
@@ -502,19 +530,278 @@ void AdScene::pathFinderStep() {
 	}
 
 	// otherwise keep on searching
-	for (i = 0; i < _pfPointsNum; i++)
+	for (int i = 0; i < _pfPointsNum; i++)
 		if (!_pfPath[i]->_marked) {
-			int j = getPointsDist(*lowestPt, *_pfPath[i], _pfRequester);
+			int j = getPointsDist(*lowestPt, *_pfPath[i], _pfRequester, true);
 			if (j != -1 && lowestPt->_distance + j < _pfPath[i]->_distance) {
 				_pfPath[i]->_distance = lowestPt->_distance + j;
 				_pfPath[i]->_origin = lowestPt;
+				pfHeapPush(_pfPath[i]->_distance, i);
 			}
 		}
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+void AdScene::pfHeapPush(int32 distance, int32 index) {
+	PfHeapEntry entry;
+	entry._distance = distance;
+	entry._index = index;
+	_pfHeap.push_back(entry);
+
+	uint pos = _pfHeap.size() - 1;
+	while (pos > 0) {
+		uint parent = (pos - 1) / 2;
+		if (!(_pfHeap[pos] < _pfHeap[parent])) {
+			break;
+		}
+		SWAP(_pfHeap[pos], _pfHeap[parent]);
+		pos = parent;
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+AdScene::PfHeapEntry AdScene::pfHeapPop() {
+	PfHeapEntry top = _pfHeap[0];
+	_pfHeap[0] = _pfHeap.back();
+	_pfHeap.pop_back();
+
+	uint pos = 0;
+	uint size = _pfHeap.size();
+	while (true) {
+		uint smallest = pos;
+		uint left = pos * 2 + 1;
+		uint right = left + 1;
+		if (left < size && _pfHeap[left] < _pfHeap[smallest]) {
+			smallest = left;
+		}
+		if (right < size && _pfHeap[right] < _pfHeap[smallest]) {
+			smallest = right;
+		}
+		if (smallest == pos) {
+			break;
+		}
+		SWAP(_pfHeap[pos], _pfHeap[smallest]);
+		pos = smallest;
+	}
+	return top;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::pfHeapRebuild() {
+	// Points that are still at INT_MAX can never be picked, leave them out
+	_pfHeap.clear();
+	for (int i = 0; i < _pfPointsNum; i++) {
+		if (!_pfPath[i]->_marked && _pfPath[i]->_distance < INT_MAX) {
+			pfHeapPush(_pfPath[i]->_distance, i);
+		}
+	}
+	_pfHeapValid = true;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+static uint32 pfHashValue(uint32 hash, uint32 value) {
+	return (hash ^ value) * 16777619;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+uint32 AdScene::pfGetRegionsSignature() {
+	uint32 hash = 2166136261u;
+	if (!_mainLayer) {
+		return hash;
+	}
+
+	hash = pfHashValue(hash, _mainLayer->_nodes.size());
+	for (uint32 i = 0; i < _mainLayer->_nodes.size(); i++) {
+		AdSceneNode *node = _mainLayer->_nodes[i];
+		if (node->_type != OBJECT_REGION) {
+			continue;
+		}
+		AdRegion *region = node->_region;
+		hash = pfHashValue(hash, (uint32)(size_t)region);
+		hash = pfHashValue(hash, (region->_active ? 1 : 0) | (region->isBlocked() ? 2 : 0) | (region->hasDecoration() ? 4 : 0));
+		hash = pfHashValue(hash, region->_rect.left);
+		hash = pfHashValue(hash, region->_rect.top);
+		hash = pfHashValue(hash, region->_rect.right);
+		hash = pfHashValue(hash, region->_rect.bottom);
+		hash = pfHashValue(hash, region->_points.size());
+		for (uint32 j = 0; j < region->_points.size(); j++) {
+			hash = pfHashValue(hash, region->_points[j]->x);
+			hash = pfHashValue(hash, region->_points[j]->y);
+		}
+	}
+	return hash;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::pfUpdateWalkGrid() {
+	uint32 signature = pfGetRegionsSignature();
+	if (_pfGridValid && signature == _pfGridSignature) {
+		return;
+	}
+	_pfGridSignature = signature;
+	_pfGridValid = true;
+	_pfGridTooLarge = false;
+	_pfSearchValid = false;
+	_pfGridRect.setEmpty();
+	_pfWalkGrid.clear();
+
+	if (!_mainLayer) {
+		return;
+	}
+
+	// No region reaches outside of its bounding rect, so neither does the grid
+	for (uint32 i = 0; i < _mainLayer->_nodes.size(); i++) {
+		AdSceneNode *node = _mainLayer->_nodes[i];
+		if (node->_type != OBJECT_REGION || !node->_region->_active || node->_region->hasDecoration()) {
+			continue;
+		}
+		const Rect32 &rect = node->_region->_rect;
+		if (rect.isRectEmpty()) {
+			continue;
+		}
+		if (_pfGridRect.isRectEmpty()) {
+			_pfGridRect = rect;
+		} else {
+			_pfGridRect.left = MIN(_pfGridRect.left, rect.left);
+			_pfGridRect.top = MIN(_pfGridRect.top, rect.top);
+			_pfGridRect.right = MAX(_pfGridRect.right, rect.right);
+			_pfGridRect.bottom = MAX(_pfGridRect.bottom, rect.bottom);
+		}
+	}
+
+	if (_pfGridRect.isRectEmpty()) {
+		return;
+	}
+
+	int32 width = _pfGridRect.width();
+	int32 height = _pfGridRect.height();
+	if ((int64)width * height > 4096 * 4096) {
+		warning("AdScene::pfUpdateWalkGrid - Regions span %dx%d pixels, not using a walk grid", width, height);
+		_pfGridTooLarge = true;
+		_pfGridRect.setEmpty();
+		return;
+	}
+	_pfWalkGrid.resize(width * height);
+	Common::fill(_pfWalkGrid.begin(), _pfWalkGrid.end(), 0);
+
+	// A point is walkable if any walkable region and no blocked region
+	// contains it, the order of the regions doesn't matter.
+	for (uint32 i = 0; i < _mainLayer->_nodes.size(); i++) {
+		AdSceneNode *node = _mainLayer->_nodes[i];
+		if (node->_type != OBJECT_REGION || !node->_region->_active || node->_region->hasDecoration()) {
+			continue;
+		}
+		AdRegion *region = node->_region;
+		byte flag = region->isBlocked() ? 2 : 1;
+		for (int32 y = region->_rect.top; y < region->_rect.bottom; y++) {
+			byte *row = _pfWalkGrid.begin() + (y - _pfGridRect.top) * width;
+			for (int32 x = region->_rect.left; x < region->_rect.right; x++) {
+				if (region->pointInRegion(x, y)) {
+					row[x - _pfGridRect.left] |= flag;
+				}
+			}
+		}
+	}
+	for (uint32 i = 0; i < _pfWalkGrid.size(); i++) {
+		_pfWalkGrid[i] = (_pfWalkGrid[i] == 1) ? 1 : 0;
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::pfUpdateSearchGrid() {
+	pfUpdateWalkGrid();
+	if (_pfGridTooLarge) {
+		return;
+	}
+
+	BaseArray<AdObject *> blockers;
+	for (uint32 i = 0; i < _objects.size(); i++) {
+		if (_objects[i]->_active && _objects[i] != _pfRequester && _objects[i]->_currentBlockRegion) {
+			blockers.add(_objects[i]);
+		}
+	}
+	AdGame *adGame = (AdGame *)_gameRef;
+	for (uint32 i = 0; i < adGame->_objects.size(); i++) {
+		if (adGame->_objects[i]->_active && adGame->_objects[i] != _pfRequester && adGame->_objects[i]->_currentBlockRegion) {
+			blockers.add(adGame->_objects[i]);
+		}
+	}
+
+	// This runs every frame while a path is searched, but blockers rarely
+	// move during a search, so only touch the grid when they did
+	uint32 signature = pfHashValue(2166136261u, blockers.size());
+	for (uint32 i = 0; i < blockers.size(); i++) {
+		BaseRegion *region = blockers[i]->_currentBlockRegion;
+		signature = pfHashValue(signature, (uint32)(size_t)region);
+		signature = pfHashValue(signature, region->_points.size());
+		for (uint32 j = 0; j < region->_points.size(); j++) {
+			signature = pfHashValue(signature, region->_points[j]->x);
+			signature = pfHashValue(signature, region->_points[j]->y);
+		}
+	}
+	if (_pfSearchValid && signature == _pfSearchSignature) {
+		return;
+	}
+
+	int32 width = _pfGridRect.width();
+	if (!_pfSearchValid || _pfSearchGrid.size() != _pfWalkGrid.size()) {
+		_pfSearchGrid = _pfWalkGrid;
+	} else {
+		// Only undo the areas stamped by the previous blockers
+		for (uint32 i = 0; i < _pfSearchRects.size(); i++) {
+			const Rect32 &rect = _pfSearchRects[i];
+			for (int32 y = rect.top; y < rect.bottom; y++) {
+				uint32 offset = (y - _pfGridRect.top) * width + (rect.left - _pfGridRect.left);
+				memcpy(_pfSearchGrid.begin() + offset, _pfWalkGrid.begin() + offset, rect.width());
+			}
+		}
+	}
+	_pfSearchRects.clear();
+	_pfSearchSignature = signature;
+	_pfSearchValid = true;
+
+	if (_pfGridRect.isRectEmpty()) {
+		return;
+	}
+
+	for (uint32 i = 0; i < blockers.size(); i++) {
+		BaseRegion *region = blockers[i]->_currentBlockRegion;
+		int32 left = MAX(region->_rect.left, _pfGridRect.left);
+		int32 top = MAX(region->_rect.top, _pfGridRect.top);
+		int32 right = MIN(region->_rect.right, _pfGridRect.right);
+		int32 bottom = MIN(region->_rect.bottom, _pfGridRect.bottom);
+		if (left >= right || top >= bottom) {
+			continue;
+		}
+		Rect32 stamped;
+		stamped.setRect(left, top, right, bottom);
+		_pfSearchRects.push_back(stamped);
+		for (int32 y = top; y < bottom; y++) {
+			byte *row = _pfSearchGrid.begin() + (y - _pfGridRect.top) * width;
+			for (int32 x = left; x < right; x++) {
+				if (row[x - _pfGridRect.left] && region->pointInRegion(x, y)) {
+					row[x - _pfGridRect.left] = 0;
+				}
+			}
+		}
+	}
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 bool AdScene::initLoop() {
+	// Free objects may have moved since the last frame
+	if (!_pfReady) {
+		pfUpdateSearchGrid();
+	}
+
 #ifdef _DEBUGxxxx
 	int nu_steps = 0;
 	uint32 start = _gameRef->_currentTime;
@@ -2348,6 +2635,16 @@ bool AdScene::persist(BasePersistenceManager *persistMgr) {
 	persistMgr->transferPtr(TMEMBER_PTR(_pfRequester));
 	persistMgr->transferPtr(TMEMBER_PTR(_pfTarget));
 	persistMgr->transferPtr(TMEMBER_PTR(_pfTargetPath));
+	if (!persistMgr->getIsSaving()) {
+		// The pathfinder's grids and heap are rebuilt when needed
+		_pfGridRect.setEmpty();
+		_pfGridSignature = 0;
+		_pfGridValid = false;
+		_pfGridTooLarge = false;
+		_pfSearchValid = false;
+		_pfHeap.clear();
+		_pfHeapValid = false;
+	}
 	_rotLevels.persist(persistMgr);
 	_scaleLevels.persist(persistMgr);
 	persistMgr->transferSint32(TMEMBER(_scrollPixelsH));
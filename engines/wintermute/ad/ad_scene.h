@@ -30,6 +30,8 @@
 #define WINTERMUTE_ADSCENE_H
 
 #include "engines/wintermute/base/base_fader.h"
+#include "engines/wintermute/math/rect32.h"
+#include "common/array.h"
 
 namespace Wintermute {
 
@@ -165,12 +167,65 @@ public:
 private:
 	bool persistState(bool saving = true);
 	void pfAddWaypointGroup(AdWaypointGroup *Wpt, BaseObject *requester = nullptr);
+	int getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject *requester, bool useGrid);
 	bool _pfReady;
 	BasePoint *_pfTarget;
 	AdPath *_pfTargetPath;
 	BaseObject *_pfRequester;
 	BaseArray<AdPathPoint *> _pfPath;
 
+	/**
+	 * Walkability of the main layer, as isBlockedAt() would report it without
+	 * free objects, one byte per pixel. It covers the bounding rects of all
+	 * regions, everything outside of it is blocked. The grid is only rebuilt
+	 * when a hash over the regions' state and points changes.
+	 */
+	void pfUpdateWalkGrid();
+	uint32 pfGetRegionsSignature();
+	/**
+	 * Copy the walk grid and stamp the block regions of free objects into it,
+	 * for the path the pathfinder is currently looking for. The grid is only
+	 * touched when a hash over the blockers' regions changes, and then only
+	 * the areas of the previous and current blockers are updated.
+	 */
+	void pfUpdateSearchGrid();
+	bool pfIsBlockedInGrid(int x, int y) const {
+		if (x < _pfGridRect.left || x >= _pfGridRect.right || y < _pfGridRect.top || y >= _pfGridRect.bottom) {
+			return true;
+		}
+		return _pfSearchGrid[(y - _pfGridRect.top) * _pfGridRect.width() + (x - _pfGridRect.left)] == 0;
+	}
+	Common::Array<byte> _pfWalkGrid;
+	Common::Array<byte> _pfSearchGrid;
+	Rect32 _pfGridRect;
+	uint32 _pfGridSignature;
+	bool _pfGridValid;
+	/** Set if the scene is too large for a grid, then blockage is tested directly */
+	bool _pfGridTooLarge;
+	/** Areas of the search grid covered by block regions, clipped to the grid */
+	Common::Array<Rect32> _pfSearchRects;
+	uint32 _pfSearchSignature;
+	bool _pfSearchValid;
+
+	/**
+	 * Binary min-heap of candidate points, ordered by distance and then by
+	 * their index in _pfPath, so points are visited in the same order a scan
+	 * for the first lowest point would visit them. Entries that went stale
+	 * because the point got a shorter distance are skipped when popped.
+	 */
+	struct PfHeapEntry {
+		int32 _distance;
+		int32 _index;
+		bool operator<(const PfHeapEntry &e) const {
+			return _distance < e._distance || (_distance == e._distance && _index < e._index);
+		}
+	};
+	void pfHeapPush(int32 distance, int32 index);
+	PfHeapEntry pfHeapPop();
+	void pfHeapRebuild();
+	Common::Array<PfHeapEntry> _pfHeap;
+	bool _pfHeapValid;
+
 	int32 _offsetTop;
 	int32 _offsetLeft;
 
@@ -29,6 +29,7 @@
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/base_engine.h"
+#include "engines/wintermute/base/scriptables/script_atom_table.h"
 #include "engines/wintermute/wintermute.h"
 #include "engines/wintermute/system/sys_class_registry.h"
 #include "common/system.h"
@@ -42,6 +43,7 @@ BaseEngine::BaseEngine() {
 	_fileManager = nullptr;
 	_gameRef = nullptr;
 	_classReg = nullptr;
+	_atoms = nullptr;
 	_rnd = nullptr;
 	_gameId = "";
 	_language = Common::UNK_LANG;
@@ -53,12 +55,14 @@ void BaseEngine::init() {
 	_rnd = new Common::RandomSource("Wintermute");
 	_classReg = new SystemClassRegistry();
 	_classReg->registerClasses();
+	_atoms = new ScAtomTable();
 }
 
 BaseEngine::~BaseEngine() {
 	delete _fileManager;
 	delete _rnd;
 	delete _classReg;
+	delete _atoms;
 }
 
 void BaseEngine::createInstance(const Common::String &targetName, const Common::String &gameId, Common::Language lang, WMETargetExecutable targetExecutable) {
@@ -93,6 +93,7 @@ class BaseGame;
 class BaseSoundMgr;
 class BaseRenderer;
 class SystemClassRegistry;
+class ScAtomTable;
 class Timer;
 class BaseEngine : public Common::Singleton<Wintermute::BaseEngine> {
 	void init();
@@ -103,6 +104,7 @@ class BaseEngine : public Common::Singleton<Wintermute::BaseEngine> {
 	// We need random numbers
 	Common::RandomSource *_rnd;
 	SystemClassRegistry *_classReg;
+	ScAtomTable *_atoms;
 	Common::Language _language;
 	WMETargetExecutable _targetExecutable;
 public:
@@ -116,6 +118,7 @@ public:
 	uint32 randInt(int from, int to);
 
 	SystemClassRegistry *getClassRegistry() { return _classReg; }
+	ScAtomTable *getAtomTable() { return _atoms; }
 	BaseGame *getGameRef() { return _gameRef; }
 	BaseFileManager *getFileManager() { return _fileManager; }
 	BaseSoundMgr *getSoundMgr();
@@ -32,6 +32,7 @@
 #include "engines/wintermute/base/file/base_savefile_manager_file.h"
 #include "engines/wintermute/base/file/base_save_thumb_file.h"
 #include "engines/wintermute/base/file/base_package.h"
+#include "engines/wintermute/base/file/package_entry_cache.h"
 #include "engines/wintermute/base/base_engine.h"
 #include "engines/wintermute/wintermute.h"
 #include "common/debug.h"
@@ -58,6 +59,7 @@ BaseFileManager::BaseFileManager(Common::Language lang, bool detectionMode) {
 	_detectionMode = detectionMode;
 	_language = lang;
 	_resources = nullptr;
+	_entryCache = new PackageEntryCache();
 	initResources();
 	initPaths();
 	registerPackages();
@@ -80,8 +82,10 @@ bool BaseFileManager::cleanup() {
 	}
 	_openFiles.clear();
 
-	// delete packages
+	// delete packages, then the entries they left in the cache
 	_packages.clear();
+	delete _entryCache;
+	_entryCache = nullptr;
 
 	// get rid of the resources:
 	delete _resources;
@@ -192,6 +196,8 @@ bool BaseFileManager::registerPackages(const Common::FSList &fslist) {
 //////////////////////////////////////////////////////////////////////////
 bool BaseFileManager::registerPackages() {
 	debugC(kWintermuteDebugFileAccess | kWintermuteDebugLog, "Scanning packages");
+	uint32 startTime = g_system->getMillis();
+	uint32 numPackages = 0;
 
 	// We need the target name as a Common::String to perform some game-specific hacks.
 	Common::String targetName = BaseEngine::instance().getGameTargetName();
@@ -290,16 +296,17 @@ bool BaseFileManager::registerPackages() {
 			}
 			debugC(kWintermuteDebugFileAccess, "Registering %s %s", fileIt->getPath().c_str(), fileIt->getName().c_str());
 			registerPackage((*fileIt), "", searchSignature);
+			numPackages++;
 		}
 	}
 
-//	debugC(kWintermuteDebugFileAccess | kWintermuteDebugLog, "  Registered %d files in %d package(s)", _files.size(), _packages.size());
+	debugC(kWintermuteDebugFileAccess | kWintermuteDebugLog, "  Registered %d package(s) in %d ms", numPackages, g_system->getMillis() - startTime);
 
 	return STATUS_OK;
 }
 
 bool BaseFileManager::registerPackage(Common::FSNode file, const Common::String &filename, bool searchSignature) {
-	PackageSet *pack = new PackageSet(file, filename, searchSignature);
+	PackageSet *pack = new PackageSet(file, filename, searchSignature, _entryCache);
 	_packages.add(file.getName(), pack, pack->getPriority() , true);
 
 	return STATUS_OK;
@@ -36,6 +36,8 @@
 #include "common/language.h"
 
 namespace Wintermute {
+class PackageEntryCache;
+
 class BaseFileManager {
 public:
 	bool cleanup();
@@ -52,6 +54,7 @@ public:
 	// Used only for detection
 	bool registerPackages(const Common::FSList &fslist);
 	static BaseFileManager *getEngineInstance();
+	PackageEntryCache *getEntryCache() { return _entryCache; }
 private:
 	typedef enum {
 		PATH_PACKAGE,
@@ -69,6 +72,8 @@ private:
 	bool registerPackage(Common::FSNode package, const Common::String &filename = "", bool searchSignature = false);
 	bool _detectionMode;
 	Common::SearchSet _packages;
+	/** Decompressed package entries, shared by all registered packages */
+	PackageEntryCache *_entryCache;
 	Common::Array<Common::SeekableReadStream *> _openFiles;
 	Common::Language _language;
 	Common::Archive *_resources;
@@ -433,6 +433,14 @@ bool BasePersistenceManager::saveFile(const Common::String &filename) {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+uint32 BasePersistenceManager::getSaveSize() const {
+	if (!_saveStream) {
+		return 0;
+	}
+	return ((Common::MemoryWriteStreamDynamic *)_saveStream)->size();
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool BasePersistenceManager::putBytes(byte *buffer, uint32 size) {
 	_saveStream->write(buffer, size);
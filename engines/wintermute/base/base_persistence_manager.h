@@ -69,6 +69,8 @@ public:
 	uint32 _offset;
 
 	bool getIsSaving() { return _saving; }
+	/** Number of bytes written to the save so far */
+	uint32 getSaveSize() const;
 
 	uint32 _richBufferSize;
 	byte *_richBuffer;
@@ -28,6 +28,7 @@
 
 #include "engines/wintermute/base/file/base_file_entry.h"
 #include "engines/wintermute/base/file/base_package.h"
+#include "engines/wintermute/base/file/package_entry_cache.h"
 #include "common/stream.h"
 #include "common/substream.h"
 #include "common/zlib.h"
@@ -35,15 +36,35 @@
 namespace Wintermute {
 
 Common::SeekableReadStream *BaseFileEntry::createReadStream() const {
+	bool compressed = (_compressedLength != 0);
+	PackageEntryCache *cache = compressed ? _package->_entryCache : nullptr;
+
+	if (cache) {
+		Common::SeekableReadStream *cached = cache->createReadStream(_package, _offset);
+		if (cached) {
+			return cached;
+		}
+	}
+
 	Common::SeekableReadStream *file = _package->getFilePointer();
 	if (!file) {
 		return nullptr;
 	}
 
-	bool compressed = (_compressedLength != 0);
-
 	if (compressed) {
 		file = Common::wrapCompressedReadStream(new Common::SeekableSubReadStream(file, _offset, _offset + _length, DisposeAfterUse::YES), _length); //
+		if (file && cache && cache->isCacheable(_length)) {
+			// Decompress the whole entry once and keep it for the next open
+			byte *data = new byte[_length];
+			uint32 size = file->read(data, _length);
+			bool failed = file->err() || size != _length;
+			delete file;
+			if (failed) {
+				delete[] data;
+				return nullptr;
+			}
+			return cache->insert(_package, _offset, data, _length);
+		}
 	} else {
 		file = new Common::SeekableSubReadStream(file, _offset, _offset + _length, DisposeAfterUse::YES);
 	}
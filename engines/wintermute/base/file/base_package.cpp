@@ -30,10 +30,12 @@
 #include "engines/wintermute/base/file/base_package.h"
 #include "engines/wintermute/base/file/base_file_entry.h"
 #include "engines/wintermute/base/file/dcpackage.h"
+#include "engines/wintermute/base/file/package_entry_cache.h"
 #include "engines/wintermute/wintermute.h"
 #include "common/file.h"
 #include "common/stream.h"
 #include "common/debug.h"
+#include "common/system.h"
 
 namespace Wintermute {
 
@@ -42,6 +44,7 @@ BasePackage::BasePackage() {
 	_cd = 0;
 	_priority = 0;
 	_boundToExe = false;
+	_entryCache = nullptr;
 }
 
 Common::SeekableReadStream *BasePackage::getFilePointer() {
@@ -110,9 +113,11 @@ void TPackageHeader::readFromStream(Common::ReadStream *stream) {
 	_numDirs = stream->readUint32LE();
 }
 
-PackageSet::PackageSet(Common::FSNode file, const Common::String &filename, bool searchSignature) {
+PackageSet::PackageSet(Common::FSNode file, const Common::String &filename, bool searchSignature, PackageEntryCache *entryCache) {
+	uint32 startTime = g_system->getMillis();
 	uint32 absoluteOffset = 0;
 	_priority = 0;
+	_entryCache = entryCache;
 	bool boundToExe = false;
 	Common::SeekableReadStream *stream = file.createReadStream();
 	if (!stream) {
@@ -156,18 +161,18 @@ PackageSet::PackageSet(Common::FSNode file, const Common::String &filename, bool
 			return;
 		}
 		pkg->_fsnode = file;
+		pkg->_entryCache = entryCache;
 
 		pkg->_boundToExe = boundToExe;
 
-		// read package info
+		// read package info, names are at most 255 bytes so one buffer does
+		char name[256];
 		byte nameLength = stream->readByte();
-		char *pkgName = new char[nameLength];
-		stream->read(pkgName, nameLength);
-		pkg->_name = pkgName;
+		stream->read(name, nameLength);
+		name[nameLength] = '\0';
+		pkg->_name = name;
 		pkg->_cd = stream->readByte();
 		pkg->_priority = hdr._priority;
-		delete[] pkgName;
-		pkgName = nullptr;
 
 		if (!hdr._masterIndex) {
 			pkg->_cd = 0;    // override CD to fixed disk
@@ -178,12 +183,11 @@ PackageSet::PackageSet(Common::FSNode file, const Common::String &filename, bool
 		uint32 numFiles = stream->readUint32LE();
 
 		for (uint32 j = 0; j < numFiles; j++) {
-			char *name;
 			uint32 offset, length, compLength, flags;/*, timeDate1, timeDate2;*/
 
 			nameLength = stream->readByte();
-			name = new char[nameLength];
 			stream->read(name, nameLength);
+			name[nameLength] = '\0';
 
 			// v2 - xor name
 			if (hdr._packageVersion == PACKAGE_VERSION) {
@@ -195,8 +199,6 @@ PackageSet::PackageSet(Common::FSNode file, const Common::String &filename, bool
 
 			Common::String upcName = name;
 			upcName.toUppercase();
-			delete[] name;
-			name = nullptr;
 
 			offset = stream->readUint32LE();
 			offset += absoluteOffset;
@@ -233,13 +235,17 @@ PackageSet::PackageSet(Common::FSNode file, const Common::String &filename, bool
 			}
 		}
 	}
-	debugC(kWintermuteDebugFileAccess, "  Registered %d files in %d package(s)", _files.size(), _packages.size());
+	debugC(kWintermuteDebugFileAccess, "  Registered %d files in %d package(s) from %s in %d ms", _files.size(), _packages.size(),
+		file.getName().c_str(), g_system->getMillis() - startTime);
 
 	delete stream;
 }
 
 PackageSet::~PackageSet() {
 	for (Common::Array<BasePackage *>::iterator it = _packages.begin(); it != _packages.end(); ++it) {
+		if (_entryCache) {
+			_entryCache->invalidatePackage(*it);
+		}
 		delete *it;
 	}
 	_packages.clear();
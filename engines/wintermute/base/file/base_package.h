@@ -34,10 +34,14 @@
 #include "common/fs.h"
 
 namespace Wintermute {
+class PackageEntryCache;
+
 class BasePackage {
 public:
 	Common::SeekableReadStream *getFilePointer();
 	Common::FSNode _fsnode;
+	/** Where decompressed entries of this package are kept, may be null */
+	PackageEntryCache *_entryCache;
 	bool _boundToExe;
 	byte _priority;
 	Common::String _name;
@@ -49,7 +53,7 @@ class PackageSet : public Common::Archive {
 public:
 	virtual ~PackageSet();
 
-	PackageSet(Common::FSNode package, const Common::String &filename = "", bool searchSignature = false);
+	PackageSet(Common::FSNode package, const Common::String &filename = "", bool searchSignature = false, PackageEntryCache *entryCache = nullptr);
 	/**
 	 * Check if a member with the given name is present in the Archive.
 	 * Patterns are not allowed, as this is meant to be a quick File::exists()
@@ -80,6 +84,7 @@ public:
 	int getPriority() const { return _priority; }
 private:
 	byte _priority;
+	PackageEntryCache *_entryCache;
 	Common::Array<BasePackage *> _packages;
 	Common::HashMap<Common::String, Common::ArchiveMemberPtr> _files;
 	Common::HashMap<Common::String, Common::ArchiveMemberPtr>::iterator _filesIter;
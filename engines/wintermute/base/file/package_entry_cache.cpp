@@ -0,0 +1,137 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+
+#include "engines/wintermute/base/file/package_entry_cache.h"
+#include "common/memstream.h"
+
+namespace Wintermute {
+
+namespace {
+
+struct ArrayDeleter {
+	void operator()(byte *data) { delete[] data; }
+};
+
+/**
+ * A read stream over a cached buffer, which keeps the buffer alive until the
+ * stream is destroyed.
+ */
+class SharedBufferReadStream : public Common::MemoryReadStream {
+public:
+	SharedBufferReadStream(const Common::SharedPtr<byte> &data, uint32 size) :
+		Common::MemoryReadStream(data.get(), size), _data(data) {}
+
+private:
+	Common::SharedPtr<byte> _data;
+};
+
+} // End of anonymous namespace
+
+PackageEntryCache::PackageEntryCache(uint32 maxBytes) : _maxBytes(maxBytes) {
+	memset(&_stats, 0, sizeof(_stats));
+}
+
+PackageEntryCache::~PackageEntryCache() {
+	flush();
+}
+
+Common::SeekableReadStream *PackageEntryCache::createReadStream(const BasePackage *package, uint32 offset) {
+	Key key;
+	key._package = package;
+	key._offset = offset;
+
+	EntryMap::iterator it = _entries.find(key);
+	if (it == _entries.end()) {
+		_stats.misses++;
+		return nullptr;
+	}
+
+	_stats.hits++;
+	// Move the entry to the front, the iterator stays valid
+	EntryList::iterator entry = it->_value;
+	if (entry != _lru.begin()) {
+		_lru.push_front(*entry);
+		_lru.erase(entry);
+		it->_value = _lru.begin();
+	}
+	return openBuffer(_lru.front()._data, _lru.front()._size);
+}
+
+Common::SeekableReadStream *PackageEntryCache::insert(const BasePackage *package, uint32 offset, byte *data, uint32 size) {
+	Entry entry;
+	entry._key._package = package;
+	entry._key._offset = offset;
+	entry._data = Buffer(data, ArrayDeleter());
+	entry._size = size;
+
+	assert(!_entries.contains(entry._key));
+
+	// Make room first, so the new entry is never the one evicted
+	while (!_lru.empty() && _stats.bytes + size > _maxBytes) {
+		removeEntry(--_lru.end());
+		_stats.evictions++;
+	}
+
+	_lru.push_front(entry);
+	_entries[entry._key] = _lru.begin();
+	_stats.bytes += size;
+	_stats.peakBytes = MAX(_stats.peakBytes, _stats.bytes);
+
+	return openBuffer(entry._data, size);
+}
+
+void PackageEntryCache::invalidatePackage(const BasePackage *package) {
+	EntryList::iterator it = _lru.begin();
+	while (it != _lru.end()) {
+		EntryList::iterator next = it;
+		++next;
+		if (it->_key._package == package) {
+			removeEntry(it);
+		}
+		it = next;
+	}
+}
+
+void PackageEntryCache::flush() {
+	_entries.clear();
+	_lru.clear();
+	_stats.bytes = 0;
+}
+
+void PackageEntryCache::resetStats() {
+	uint32 bytes = _stats.bytes;
+	memset(&_stats, 0, sizeof(_stats));
+	_stats.bytes = _stats.peakBytes = bytes;
+}
+
+Common::SeekableReadStream *PackageEntryCache::openBuffer(const Buffer &data, uint32 size) {
+	return new SharedBufferReadStream(data, size);
+}
+
+void PackageEntryCache::removeEntry(EntryList::iterator entry) {
+	_stats.bytes -= entry->_size;
+	_entries.erase(entry->_key);
+	_lru.erase(entry);
+}
+
+} // End of namespace Wintermute
@@ -0,0 +1,116 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+
+#ifndef WINTERMUTE_PACKAGE_ENTRY_CACHE_H
+#define WINTERMUTE_PACKAGE_ENTRY_CACHE_H
+
+#include "common/hashmap.h"
+#include "common/list.h"
+#include "common/ptr.h"
+#include "common/stream.h"
+
+namespace Wintermute {
+
+class BasePackage;
+
+/**
+ * A bounded cache of decompressed package entries.
+ *
+ * Compressed entries have to go through zlib every time they are opened, and
+ * games open the same small files (scripts, sprite definitions, fonts) again
+ * and again. The decompressed bytes of such entries are kept here, least
+ * recently used first, until the byte budget runs out. Streams handed out share
+ * the buffer with the cache, so an entry can be evicted while it is still read.
+ */
+class PackageEntryCache {
+public:
+	struct Stats {
+		uint32 hits;         ///< Opens served from the cache
+		uint32 misses;       ///< Opens that had to decompress the entry
+		uint32 evictions;    ///< Entries dropped to stay within budget
+		uint32 bytes;        ///< Bytes currently held by the cache
+		uint32 peakBytes;    ///< Largest value bytes has reached
+	};
+
+	PackageEntryCache(uint32 maxBytes = kDefaultMaxBytes);
+	~PackageEntryCache();
+
+	/**
+	 * Open the cached copy of the entry at this offset of the package, or
+	 * return nullptr if it isn't cached. Counts a hit or a miss.
+	 */
+	Common::SeekableReadStream *createReadStream(const BasePackage *package, uint32 offset);
+	/** Whether an entry of this size is small enough to be worth keeping. */
+	bool isCacheable(uint32 size) const { return size <= _maxBytes / 4; }
+	/**
+	 * Take ownership of a decompressed entry (allocated with new[]) and open
+	 * it. The entry must not be cached already.
+	 */
+	Common::SeekableReadStream *insert(const BasePackage *package, uint32 offset, byte *data, uint32 size);
+	/** Forget all entries of a package that is going away. */
+	void invalidatePackage(const BasePackage *package);
+	/** Free all entries. */
+	void flush();
+
+	const Stats &getStats() const { return _stats; }
+	void resetStats();
+	uint getNumEntries() const { return _entries.size(); }
+
+	static const uint32 kDefaultMaxBytes = 4 * 1024 * 1024;
+
+private:
+	typedef Common::SharedPtr<byte> Buffer;
+
+	struct Key {
+		const BasePackage *_package;
+		uint32 _offset;
+
+		bool operator==(const Key &k) const { return _package == k._package && _offset == k._offset; }
+	};
+
+	struct KeyHash {
+		uint operator()(const Key &k) const { return (uint)(size_t)k._package * 31 + k._offset; }
+	};
+
+	struct Entry {
+		Key _key;
+		Buffer _data;
+		uint32 _size;
+	};
+
+	typedef Common::List<Entry> EntryList;
+	typedef Common::HashMap<Key, EntryList::iterator, KeyHash> EntryMap;
+
+	static Common::SeekableReadStream *openBuffer(const Buffer &data, uint32 size);
+	void removeEntry(EntryList::iterator entry);
+
+	/** Most recently used first */
+	EntryList _lru;
+	EntryMap _entries;
+	uint32 _maxBytes;
+	Stats _stats;
+};
+
+} // End of namespace Wintermute
+
+#endif
@@ -34,9 +34,14 @@
 #include "engines/wintermute/base/base_region.h"
 #include "engines/wintermute/platform_osystem.h"
 #include "engines/wintermute/base/base_persistence_manager.h"
+#include "common/system.h"
 
 namespace Wintermute {
 
+// Every indicator redisplay waits for a screen update, which is far slower
+// than the saving or loading in between, so keep them a frame apart.
+static const uint32 kIndicatorInterval = 20;
+
 //////////////////////////////////////////////////////////////////////
 BaseRenderer::BaseRenderer(BaseGame *inGame) : BaseClass(inGame) {
 	_window = 0;
@@ -49,6 +54,8 @@ BaseRenderer::BaseRenderer(BaseGame *inGame) : BaseClass(inGame) {
 	_indicatorDisplay = false;
 	_indicatorColor = BYTETORGBA(255, 0, 0, 128);
 	_indicatorProgress = 0;
+	_indicatorTime = 0;
+	_indicatorPending = false;
 	_indicatorX = -1;
 	_indicatorY = -1;
 	_indicatorWidth = -1;
@@ -108,8 +115,15 @@ void BaseRenderer::setIndicator(int width, int height, int x, int y, uint32 colo
 void BaseRenderer::setIndicatorVal(int value) {
 	bool redisplay = (_indicatorProgress != value);
 	_indicatorProgress = value;
-	if (redisplay)
+	uint32 time = g_system->getMillis();
+	if (redisplay && (time - _indicatorTime >= kIndicatorInterval || value >= 100)) {
+		_indicatorTime = time;
+		_indicatorPending = false;
 		displayIndicator();
+	} else if (redisplay) {
+		// Shown by the next update, or by endSaveLoad() if there is none
+		_indicatorPending = true;
+	}
 }
 
 void BaseRenderer::setLoadingScreen(const char *filename, int x, int y) {
@@ -135,6 +149,8 @@ void BaseRenderer::setSaveImage(const char *filename, int x, int y) {
 void BaseRenderer::initSaveLoad(bool isSaving, bool quickSave) {
 	_indicatorDisplay = true;
 	_indicatorProgress = 0;
+	_indicatorTime = 0;
+	_indicatorPending = false;
 	_hasDrawnSaveLoadImage = false;
 
 	if (isSaving && !quickSave) {
@@ -164,6 +180,12 @@ void BaseRenderer::initSaveLoad(bool isSaving, bool quickSave) {
 }
 
 void BaseRenderer::endSaveLoad() {
+	// Progress updates are throttled, make sure the final one is drawn
+	if (_indicatorPending) {
+		_indicatorPending = false;
+		displayIndicator();
+	}
+
 	_loadInProgress = false;
 	_indicatorDisplay = false;
 	_indicatorWidthDrawn = 0;
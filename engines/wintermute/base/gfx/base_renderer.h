@@ -214,6 +214,10 @@ protected:
 	bool _loadInProgress;
 	bool _indicatorDisplay;
 	int32 _indicatorProgress;
+	/** When the indicator was last put on screen */
+	uint32 _indicatorTime;
+	/** Set if the last progress value was throttled and is not on screen yet */
+	bool _indicatorPending;
 
 	uint32 _clipperWindow;
 
@@ -30,9 +30,12 @@
 #define WINTERMUTE_BASE_RENDERER_SDL_H
 
 #include "engines/wintermute/base/gfx/base_renderer.h"
+#include "engines/wintermute/base/gfx/osystem/dirty_rect_container.h"
+#include "engines/wintermute/base/gfx/osystem/transformed_surface_cache.h"
 #include "common/rect.h"
 #include "graphics/surface.h"
 #include "common/list.h"
+#include "common/hashmap.h"
 #include "graphics/transform_struct.h"
 
 namespace Wintermute {
@@ -53,6 +56,11 @@ class RenderTicket;
  * being equal, this information is then used to check whether the draw order changed,
  * which will then create a need for redrawing, as we draw with an alpha-channel here.
  *
+ * Tickets are indexed by a hash of their draw arguments, so matching an incoming
+ * draw-call against last frame's tickets doesn't need a walk through the queue.
+ * The dirty region is kept as a set of disjoint rects, which are cleared, redrawn
+ * and copied to the screen independently.
+ *
  * There is also a draw path that draws without tickets, for debugging purposes,
  * as well as to accomodate situations with large enough amounts of draw calls,
  * that there will be too much overhead involved with comparing the generated tickets.
@@ -79,7 +87,12 @@ public:
 	BaseImage *takeScreenshot() override;
 
 	void invalidateTicket(RenderTicket *renderTicket);
+	/**
+	 * Invalidate all tickets drawn from a surface, as well as any
+	 * cached copies of its pixels.
+	 */
 	void invalidateTicketsFromSurface(BaseSurfaceOSystem *surf);
+	TransformedSurfaceCache *getSurfaceCache() { return &_surfaceCache; }
 	/**
 	 * Insert a new ticket into the queue, adding a dirty rect
 	 * @param renderTicket the ticket to be added.
@@ -126,8 +139,19 @@ private:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
-	Common::Rect *_dirtyRect;
+	/**
+	 * Find the first ticket from last frame that hasn't been drawn yet this frame,
+	 * and is equal to the given ticket.
+	 * @return the matching ticket, or nullptr if there is none.
+	 */
+	RenderTicket *findQueuedTicket(const RenderTicket &compare) const;
+	void indexTicket(RenderTicket *ticket);
+	void unindexTicket(RenderTicket *ticket);
+	DirtyRectContainer _dirtyRects;
 	Common::List<RenderTicket *> _renderQueue;
+	typedef Common::HashMap<uint32, Common::Array<RenderTicket *> > TicketIndex;
+	TicketIndex _ticketIndex;
+	TransformedSurfaceCache _surfaceCache;
 
 	bool _needsFlip;
 	RenderQueueIterator _lastFrameIter;
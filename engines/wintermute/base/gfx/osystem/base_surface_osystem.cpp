@@ -150,6 +150,10 @@ bool BaseSurfaceOSystem::finishLoad() {
 	_surface->free();
 	delete _surface;
 
+	// The renderer may still hold copies of what was loaded before
+	BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_gameRef->_renderer);
+	renderer->getSurfaceCache()->invalidateOwner(this);
+
 	bool needsColorKey = false;
 	bool replaceAlpha = true;
 	if (image->getSurface()->format.bytesPerPixel == 1) {
@@ -0,0 +1,77 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "engines/wintermute/base/gfx/osystem/dirty_rect_container.h"
+
+namespace Wintermute {
+
+DirtyRectContainer::DirtyRectContainer() {
+}
+
+void DirtyRectContainer::addDirtyRect(const Common::Rect &rect, const Common::Rect &clipRect) {
+	Common::Rect dirty(rect);
+	dirty.clip(clipRect);
+	if (dirty.isEmpty()) {
+		return;
+	}
+
+	// Swallow every rect the new one should be merged with. The merged rect may
+	// grow into rects that were already checked, so start over after each merge.
+	uint i = 0;
+	while (i < _rects.size()) {
+		if (shouldMerge(_rects[i], dirty)) {
+			dirty.extend(_rects[i]);
+			_rects.remove_at(i);
+			i = 0;
+		} else {
+			++i;
+		}
+	}
+	_rects.push_back(dirty);
+
+	if (_rects.size() > kMaxRects) {
+		Common::Rect bounds(_rects[0]);
+		for (i = 1; i < _rects.size(); i++) {
+			bounds.extend(_rects[i]);
+		}
+		_rects.clear();
+		_rects.push_back(bounds);
+	}
+}
+
+void DirtyRectContainer::reset() {
+	_rects.clear();
+}
+
+bool DirtyRectContainer::shouldMerge(const Common::Rect &a, const Common::Rect &b) {
+	if (a.intersects(b)) {
+		return true;
+	}
+	// Join disjoint rects if the union adds at most a quarter of their area.
+	Common::Rect joined(a);
+	joined.extend(b);
+	int32 area = (int32)a.width() * a.height() + (int32)b.width() * b.height();
+	int32 joinedArea = (int32)joined.width() * joined.height();
+	return joinedArea - area <= area / 4;
+}
+
+} // End of namespace Wintermute
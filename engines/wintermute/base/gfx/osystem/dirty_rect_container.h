@@ -0,0 +1,62 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef WINTERMUTE_DIRTY_RECT_CONTAINER_H
+#define WINTERMUTE_DIRTY_RECT_CONTAINER_H
+
+#include "common/array.h"
+#include "common/rect.h"
+
+namespace Wintermute {
+
+/**
+ * The dirty region of the screen, kept as a small set of disjoint rects.
+ * Rects that overlap, or that would waste only a few pixels when joined,
+ * are merged as they come in, so that two small changes in opposite corners
+ * of the screen don't force a redraw of everything in between. If too many
+ * rects accumulate they are collapsed into their bounding rect.
+ */
+class DirtyRectContainer {
+public:
+	DirtyRectContainer();
+
+	/**
+	 * Mark a region as dirty.
+	 * @param rect the region to add
+	 * @param clipRect the rect is clipped to this region first
+	 */
+	void addDirtyRect(const Common::Rect &rect, const Common::Rect &clipRect);
+	void reset();
+	bool isEmpty() const { return _rects.empty(); }
+	/** The current dirty rects, none of which overlap each other. */
+	const Common::Array<Common::Rect> &getRects() const { return _rects; }
+
+	static const uint kMaxRects = 16;
+private:
+	static bool shouldMerge(const Common::Rect &a, const Common::Rect &b);
+
+	Common::Array<Common::Rect> _rects;
+};
+
+} // End of namespace Wintermute
+
+#endif
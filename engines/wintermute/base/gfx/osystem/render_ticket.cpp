@@ -30,66 +30,39 @@
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/gfx/osystem/render_ticket.h"
 #include "engines/wintermute/base/gfx/osystem/base_surface_osystem.h"
-#include "graphics/transform_tools.h"
 #include "common/textconsole.h"
 
 namespace Wintermute {
 
-RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct transform) :
+RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct transform, TransformedSurfaceCache *cache) :
 	_owner(owner),
 	_srcRect(*srcRect),
 	_dstRect(*dstRect),
 	_isValid(true),
 	_wantsDraw(true),
-	_transform(transform) {
+	_drawNum(0),
+	_transform(transform),
+	_surface(nullptr),
+	_cache(nullptr),
+	_cacheEntry(nullptr) {
+	_hash = computeHash();
 	if (surf) {
-		_surface = new Graphics::Surface();
-		_surface->create((uint16)srcRect->width(), (uint16)srcRect->height(), surf->format);
-		assert(_surface->format.bytesPerPixel == 4);
-		// Get a clipped copy of the surface
-		for (int i = 0; i < _surface->h; i++) {
-			memcpy(_surface->getBasePtr(0, i), surf->getBasePtr(srcRect->left, srcRect->top + i), srcRect->width() * _surface->format.bytesPerPixel);
-		}
-		// Then scale it if necessary
-		//
-		// NB: The numTimesX/numTimesY properties don't yet mix well with
-		// scaling and rotation, but there is no need for that functionality at
-		// the moment.
-		// NB: Mirroring and rotation are probably done in the wrong order.
-		// (Mirroring should most likely be done before rotation. See also
-		// TransformTools.)
-		if (_transform._angle != Graphics::kDefaultAngle) {
-			Graphics::TransparentSurface src(*_surface, false);
-			Graphics::Surface *temp;
-			if (owner->_gameRef->getBilinearFiltering()) {
-				temp = src.rotoscaleT<Graphics::FILTER_BILINEAR>(transform);
-			} else {
-				temp = src.rotoscaleT<Graphics::FILTER_NEAREST>(transform);
-			}
-			_surface->free();
-			delete _surface;
-			_surface = temp;
-		} else if ((dstRect->width() != srcRect->width() ||
-					dstRect->height() != srcRect->height()) &&
-					_transform._numTimesX * _transform._numTimesY == 1) {
-			Graphics::TransparentSurface src(*_surface, false);
-			Graphics::Surface *temp;
-			if (owner->_gameRef->getBilinearFiltering()) {
-				temp = src.scaleT<Graphics::FILTER_BILINEAR>(dstRect->width(), dstRect->height());
-			} else {
-				temp = src.scaleT<Graphics::FILTER_NEAREST>(dstRect->width(), dstRect->height());
-			}
-			_surface->free();
-			delete _surface;
-			_surface = temp;
+		bool bilinear = owner && owner->_gameRef->getBilinearFiltering();
+		// Fade-tickets are owner-less, their surface only lives for the draw-call
+		if (cache && owner) {
+			_cache = cache;
+			_cacheEntry = cache->acquire(owner, surf, *srcRect, *dstRect, transform, bilinear);
+			_surface = _cacheEntry->_surface;
+		} else {
+			_surface = TransformedSurfaceCache::createSurface(surf, *srcRect, *dstRect, transform, bilinear);
 		}
-	} else {
-		_surface = nullptr;
 	}
 }
 
 RenderTicket::~RenderTicket() {
-	if (_surface) {
+	if (_cacheEntry) {
+		_cache->release(_cacheEntry);
+	} else if (_surface) {
 		_surface->free();
 		delete _surface;
 	}
@@ -106,6 +79,21 @@ bool RenderTicket::operator==(const RenderTicket &t) const {
 	return true;
 }
 
+uint32 RenderTicket::computeHash() const {
+	// Only a subset of the compared fields goes into the hash, equal tickets
+	// still have to be confirmed with operator==.
+	uint32 hash = (uint32)(size_t)_owner;
+	hash = hash * 31 + (uint16)_dstRect.left;
+	hash = hash * 31 + (uint16)_dstRect.top;
+	hash = hash * 31 + (uint16)_dstRect.right;
+	hash = hash * 31 + (uint16)_dstRect.bottom;
+	hash = hash * 31 + (uint16)_srcRect.left;
+	hash = hash * 31 + (uint16)_srcRect.top;
+	hash = hash * 31 + (uint32)_transform._angle;
+	hash = hash * 31 + _transform._rgbaMod;
+	return hash;
+}
+
 // Replacement for SDL2's SDL_RenderCopy
 void RenderTicket::drawToSurface(Graphics::Surface *_targetSurface) const {
 	Graphics::TransparentSurface src(*getSurface(), false);
@@ -29,6 +29,7 @@
 #ifndef WINTERMUTE_RENDER_TICKET_H
 #define WINTERMUTE_RENDER_TICKET_H
 
+#include "engines/wintermute/base/gfx/osystem/transformed_surface_cache.h"
 #include "graphics/transparent_surface.h"
 #include "graphics/surface.h"
 #include "common/rect.h"
@@ -51,8 +52,12 @@ class BaseSurfaceOSystem;
  */
 class RenderTicket {
 public:
-	RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRest, Graphics::TransformStruct transform);
-	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()) {}
+	/**
+	 * @param cache if given, the ticket shares its surface with other tickets
+	 *        drawing the same pixels instead of building its own copy.
+	 */
+	RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRest, Graphics::TransformStruct transform, TransformedSurfaceCache *cache = nullptr);
+	RenderTicket() : _isValid(true), _wantsDraw(false), _drawNum(0), _hash(0), _transform(Graphics::TransformStruct()), _surface(nullptr), _cache(nullptr), _cacheEntry(nullptr) {}
 	~RenderTicket();
 	const Graphics::Surface *getSurface() const { return _surface; }
 	// Non-dirty-rects:
@@ -64,14 +69,24 @@ public:
 
 	bool _isValid;
 	bool _wantsDraw;
+	/** Position of the ticket in the render queue as of the last drawn frame */
+	uint32 _drawNum;
 
 	Graphics::TransformStruct _transform;
 
 	BaseSurfaceOSystem *_owner;
 	bool operator==(const RenderTicket &a) const;
 	const Common::Rect *getSrcRect() const { return &_srcRect; }
+	/** Hash over the fields compared by operator==, for looking up equal tickets */
+	uint32 getHash() const { return _hash; }
 private:
+	uint32 computeHash() const;
+
+	uint32 _hash;
+
 	Graphics::Surface *_surface;
+	TransformedSurfaceCache *_cache;
+	TransformedSurfaceCache::Entry *_cacheEntry;
 	Common::Rect _srcRect;
 };
 
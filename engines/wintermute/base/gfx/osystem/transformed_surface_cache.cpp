@@ -0,0 +1,254 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "engines/wintermute/base/gfx/osystem/transformed_surface_cache.h"
+#include "graphics/transparent_surface.h"
+#include "common/textconsole.h"
+
+namespace Wintermute {
+
+bool TransformedSurfaceCache::Key::operator==(const Key &k) const {
+	return _owner == k._owner &&
+		_srcRect == k._srcRect &&
+		_angle == k._angle &&
+		_zoom == k._zoom &&
+		_hotspot == k._hotspot &&
+		_scaledWidth == k._scaledWidth &&
+		_scaledHeight == k._scaledHeight &&
+		_bilinear == k._bilinear;
+}
+
+uint TransformedSurfaceCache::KeyHash::operator()(const Key &k) const {
+	uint hash = (uint)(size_t)k._owner;
+	hash = hash * 31 + (uint16)k._srcRect.left;
+	hash = hash * 31 + (uint16)k._srcRect.top;
+	hash = hash * 31 + (uint16)k._srcRect.right;
+	hash = hash * 31 + (uint16)k._srcRect.bottom;
+	hash = hash * 31 + (uint)k._angle;
+	hash = hash * 31 + (uint16)k._zoom.x;
+	hash = hash * 31 + (uint16)k._zoom.y;
+	hash = hash * 31 + (uint16)k._scaledWidth;
+	hash = hash * 31 + (uint16)k._scaledHeight;
+	return hash;
+}
+
+TransformedSurfaceCache::TransformedSurfaceCache(uint32 maxBytes) : _maxBytes(maxBytes) {
+	memset(&_stats, 0, sizeof(_stats));
+}
+
+TransformedSurfaceCache::~TransformedSurfaceCache() {
+	for (EntryMap::iterator it = _entries.begin(); it != _entries.end(); ++it) {
+		if (it->_value->_refCount) {
+			warning("TransformedSurfaceCache: Entry still in use on destruction");
+		}
+		freeEntry(it->_value);
+	}
+}
+
+TransformedSurfaceCache::Key TransformedSurfaceCache::makeKey(BaseSurfaceOSystem *owner, const Common::Rect &srcRect, const Common::Rect &dstRect, const Graphics::TransformStruct &transform, bool bilinear) {
+	Key key;
+	key._owner = owner;
+	key._srcRect = srcRect;
+	key._angle = 0;
+	key._zoom = Common::Point(Graphics::kDefaultZoomX, Graphics::kDefaultZoomY);
+	key._hotspot = Common::Point();
+	key._scaledWidth = 0;
+	key._scaledHeight = 0;
+	key._bilinear = false;
+	// Mirror the branches in createSurface(), so that draws producing the
+	// same pixels end up with the same key.
+	if (transform._angle != Graphics::kDefaultAngle) {
+		key._angle = transform._angle;
+		key._zoom = transform._zoom;
+		key._hotspot = transform._hotspot;
+		key._bilinear = bilinear;
+	} else if ((dstRect.width() != srcRect.width() ||
+				dstRect.height() != srcRect.height()) &&
+				transform._numTimesX * transform._numTimesY == 1) {
+		key._scaledWidth = dstRect.width();
+		key._scaledHeight = dstRect.height();
+		key._bilinear = bilinear;
+	}
+	return key;
+}
+
+Graphics::Surface *TransformedSurfaceCache::createSurface(const Graphics::Surface *surf, const Common::Rect &srcRect, const Common::Rect &dstRect, const Graphics::TransformStruct &transform, bool bilinear) {
+	Graphics::Surface *surface = new Graphics::Surface();
+	surface->create((uint16)srcRect.width(), (uint16)srcRect.height(), surf->format);
+	assert(surface->format.bytesPerPixel == 4);
+	// Get a clipped copy of the surface
+	for (int i = 0; i < surface->h; i++) {
+		memcpy(surface->getBasePtr(0, i), surf->getBasePtr(srcRect.left, srcRect.top + i), srcRect.width() * surface->format.bytesPerPixel);
+	}
+	// Then scale it if necessary
+	//
+	// NB: The numTimesX/numTimesY properties don't yet mix well with
+	// scaling and rotation, but there is no need for that functionality at
+	// the moment.
+	// NB: Mirroring and rotation are probably done in the wrong order.
+	// (Mirroring should most likely be done before rotation. See also
+	// TransformTools.)
+	if (transform._angle != Graphics::kDefaultAngle) {
+		Graphics::TransparentSurface src(*surface, false);
+		Graphics::Surface *temp;
+		if (bilinear) {
+			temp = src.rotoscaleT<Graphics::FILTER_BILINEAR>(transform);
+		} else {
+			temp = src.rotoscaleT<Graphics::FILTER_NEAREST>(transform);
+		}
+		surface->free();
+		delete surface;
+		surface = temp;
+	} else if ((dstRect.width() != srcRect.width() ||
+				dstRect.height() != srcRect.height()) &&
+				transform._numTimesX * transform._numTimesY == 1) {
+		Graphics::TransparentSurface src(*surface, false);
+		Graphics::Surface *temp;
+		if (bilinear) {
+			temp = src.scaleT<Graphics::FILTER_BILINEAR>(dstRect.width(), dstRect.height());
+		} else {
+			temp = src.scaleT<Graphics::FILTER_NEAREST>(dstRect.width(), dstRect.height());
+		}
+		surface->free();
+		delete surface;
+		surface = temp;
+	}
+	return surface;
+}
+
+TransformedSurfaceCache::Entry *TransformedSurfaceCache::acquire(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, const Common::Rect &srcRect, const Common::Rect &dstRect, const Graphics::TransformStruct &transform, bool bilinear) {
+	Key key = makeKey(owner, srcRect, dstRect, transform, bilinear);
+
+	EntryMap::iterator it = _entries.find(key);
+	if (it != _entries.end()) {
+		Entry *entry = it->_value;
+		if (entry->_refCount == 0) {
+			_unused.erase(entry->_unusedPos);
+		}
+		entry->_refCount++;
+		_stats.hits++;
+		return entry;
+	}
+
+	_stats.misses++;
+	if (key._angle != 0 || key._scaledWidth != 0) {
+		_stats.transformed++;
+	}
+
+	Entry *entry = new Entry();
+	entry->_key = key;
+	entry->_surface = createSurface(surf, srcRect, dstRect, transform, bilinear);
+	entry->_refCount = 1;
+	entry->_detached = false;
+	_entries[key] = entry;
+	_ownerEntries[owner].push_back(entry);
+
+	_stats.bytes += entry->_surface->pitch * entry->_surface->h;
+	if (_stats.bytes > _stats.peakBytes) {
+		_stats.peakBytes = _stats.bytes;
+	}
+	evictUnused();
+	return entry;
+}
+
+void TransformedSurfaceCache::release(Entry *entry) {
+	assert(entry->_refCount > 0);
+	if (--entry->_refCount) {
+		return;
+	}
+	if (entry->_detached) {
+		freeEntry(entry);
+		return;
+	}
+	_unused.push_back(entry);
+	entry->_unusedPos = _unused.reverse_begin();
+	evictUnused();
+}
+
+void TransformedSurfaceCache::invalidateOwner(BaseSurfaceOSystem *owner) {
+	OwnerMap::iterator ownerIt = _ownerEntries.find(owner);
+	if (ownerIt == _ownerEntries.end()) {
+		return;
+	}
+	Common::Array<Entry *> &entries = ownerIt->_value;
+	for (uint i = 0; i < entries.size(); i++) {
+		Entry *entry = entries[i];
+		_entries.erase(entry->_key);
+		_stats.invalidations++;
+		if (entry->_refCount == 0) {
+			_unused.erase(entry->_unusedPos);
+			freeEntry(entry);
+		} else {
+			// Still referenced by a ticket, free it once that is done with it.
+			entry->_detached = true;
+		}
+	}
+	_ownerEntries.erase(ownerIt);
+}
+
+void TransformedSurfaceCache::flush() {
+	while (!_unused.empty()) {
+		removeUnused(_unused.front());
+	}
+}
+
+void TransformedSurfaceCache::resetStats() {
+	uint32 bytes = _stats.bytes;
+	memset(&_stats, 0, sizeof(_stats));
+	_stats.bytes = bytes;
+	_stats.peakBytes = bytes;
+}
+
+void TransformedSurfaceCache::freeEntry(Entry *entry) {
+	_stats.bytes -= entry->_surface->pitch * entry->_surface->h;
+	entry->_surface->free();
+	delete entry->_surface;
+	delete entry;
+}
+
+void TransformedSurfaceCache::removeUnused(Entry *entry) {
+	_unused.erase(entry->_unusedPos);
+	_entries.erase(entry->_key);
+	OwnerMap::iterator ownerIt = _ownerEntries.find(entry->_key._owner);
+	if (ownerIt != _ownerEntries.end()) {
+		Common::Array<Entry *> &entries = ownerIt->_value;
+		for (uint i = 0; i < entries.size(); i++) {
+			if (entries[i] == entry) {
+				entries.remove_at(i);
+				break;
+			}
+		}
+		if (entries.empty()) {
+			_ownerEntries.erase(ownerIt);
+		}
+	}
+	freeEntry(entry);
+}
+
+void TransformedSurfaceCache::evictUnused() {
+	while (_stats.bytes > _maxBytes && !_unused.empty()) {
+		removeUnused(_unused.front());
+		_stats.evictions++;
+	}
+}
+
+} // End of namespace Wintermute
@@ -0,0 +1,143 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef WINTERMUTE_TRANSFORMED_SURFACE_CACHE_H
+#define WINTERMUTE_TRANSFORMED_SURFACE_CACHE_H
+
+#include "common/array.h"
+#include "common/hashmap.h"
+#include "common/list.h"
+#include "common/rect.h"
+#include "graphics/surface.h"
+#include "graphics/transform_struct.h"
+
+namespace Wintermute {
+
+class BaseSurfaceOSystem;
+
+/**
+ * A bounded cache of the surfaces render tickets draw from.
+ *
+ * Creating a ticket means copying the source rect out of the owner's surface,
+ * and rotating or scaling that copy if the draw asks for it. Sprites are drawn
+ * with the same source rect and transform over and over, usually while only
+ * their position changes, so the result is shared between all tickets that
+ * would produce the same pixels. Entries are reference counted: an entry in
+ * use by a ticket is never freed, unused entries are kept until the byte
+ * budget runs out, least recently used first.
+ *
+ * When the owner's pixels change, its entries are dropped from the cache;
+ * tickets still holding one keep their copy until they go away, which is what
+ * the ticket-system promises.
+ */
+class TransformedSurfaceCache {
+public:
+	struct Entry;
+
+	struct Stats {
+		uint32 hits;           ///< Lookups served from the cache
+		uint32 misses;         ///< Lookups that had to build a new surface
+		uint32 transformed;    ///< Misses that also had to rotate or scale
+		uint32 evictions;      ///< Unused entries freed to stay within budget
+		uint32 invalidations;  ///< Entries dropped because their owner changed
+		uint32 bytes;          ///< Bytes currently held by entries
+		uint32 peakBytes;      ///< Largest value bytes has reached
+	};
+
+	TransformedSurfaceCache(uint32 maxBytes = kDefaultMaxBytes);
+	~TransformedSurfaceCache();
+
+	/**
+	 * Get the surface a ticket for the given draw should use, building it if
+	 * necessary. The entry stays alive until it is passed to release().
+	 */
+	Entry *acquire(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, const Common::Rect &srcRect, const Common::Rect &dstRect, const Graphics::TransformStruct &transform, bool bilinear);
+	void release(Entry *entry);
+	/** Forget all entries built from this owner's pixels. */
+	void invalidateOwner(BaseSurfaceOSystem *owner);
+	/** Free all entries that are not in use. */
+	void flush();
+
+	const Stats &getStats() const { return _stats; }
+	void resetStats();
+	uint getNumEntries() const { return _entries.size(); }
+
+	/**
+	 * Build the surface a ticket draws from: a copy of srcRect, rotated or
+	 * scaled to fit dstRect as the transform requires. The caller owns the result.
+	 */
+	static Graphics::Surface *createSurface(const Graphics::Surface *surf, const Common::Rect &srcRect, const Common::Rect &dstRect, const Graphics::TransformStruct &transform, bool bilinear);
+
+	static const uint32 kDefaultMaxBytes = 8 * 1024 * 1024;
+
+	struct Key {
+		BaseSurfaceOSystem *_owner;
+		Common::Rect _srcRect;
+		/** Only the parts of the transform that affect the built pixels */
+		int32 _angle;
+		Common::Point _zoom;
+		Common::Point _hotspot;
+		int16 _scaledWidth;
+		int16 _scaledHeight;
+		bool _bilinear;
+
+		bool operator==(const Key &k) const;
+	};
+
+	struct KeyHash {
+		uint operator()(const Key &k) const;
+	};
+
+	struct Entry {
+		Key _key;
+		Graphics::Surface *_surface;
+		uint32 _refCount;
+		/** Set once the entry is no longer reachable through the cache */
+		bool _detached;
+		Common::List<Entry *>::iterator _unusedPos;
+	};
+
+private:
+	static Key makeKey(BaseSurfaceOSystem *owner, const Common::Rect &srcRect, const Common::Rect &dstRect, const Graphics::TransformStruct &transform, bool bilinear);
+	void freeEntry(Entry *entry);
+	/** Drop an entry no ticket refers to from the cache and free it */
+	void removeUnused(Entry *entry);
+	void evictUnused();
+
+	struct OwnerHash {
+		uint operator()(const BaseSurfaceOSystem *owner) const { return (uint)(size_t)owner; }
+	};
+
+	typedef Common::HashMap<Key, Entry *, KeyHash> EntryMap;
+	typedef Common::HashMap<BaseSurfaceOSystem *, Common::Array<Entry *>, OwnerHash> OwnerMap;
+	EntryMap _entries;
+	/** The entries of each owner, so invalidating one doesn't walk the whole cache */
+	OwnerMap _ownerEntries;
+	/** Entries no ticket refers to, least recently used first */
+	Common::List<Entry *> _unused;
+	uint32 _maxBytes;
+	Stats _stats;
+};
+
+} // End of namespace Wintermute
+
+#endif
@@ -40,6 +40,8 @@
 #include "engines/wintermute/base/scriptables/script.h"
 #include "common/savefile.h"
 #include "common/config-manager.h"
+#include "common/debug.h"
+#include "common/system.h"
 
 namespace Wintermute {
 
@@ -93,13 +95,20 @@ bool SaveLoad::saveGame(int slot, const char *desc, bool quickSave, BaseGame *ga
 
 	bool ret;
 
+	// The save is built in two phases: the object graph is first serialized
+	// into memory, then the buffer is compressed and written out in one go.
+	uint32 startTime = g_system->getMillis();
 	BasePersistenceManager *pm = new BasePersistenceManager();
 	if (DID_SUCCEED(ret = pm->initSave(desc))) {
 		gameRef->_renderer->initSaveLoad(true, quickSave); // TODO: The original code inited the indicator before the conditionals
 		if (DID_SUCCEED(ret = SystemClassRegistry::getInstance()->saveTable(gameRef,  pm, quickSave))) {
 			if (DID_SUCCEED(ret = SystemClassRegistry::getInstance()->saveInstances(gameRef,  pm, quickSave))) {
 				pm->putDWORD(BaseEngine::instance().getRandomSource()->getSeed());
-				if (DID_SUCCEED(ret = pm->saveFile(filename))) {
+				uint32 writeTime = g_system->getMillis();
+				debugC(kWintermuteDebugSaveGame, "Serialized %d bytes in %d ms", pm->getSaveSize(), writeTime - startTime);
+				ret = pm->saveFile(filename);
+				debugC(kWintermuteDebugSaveGame, "Wrote '%s' in %d ms", filename.c_str(), g_system->getMillis() - writeTime);
+				if (DID_SUCCEED(ret)) {
 					ConfMan.setInt("most_recent_saveslot", slot);
 					ConfMan.flushToDisk();
 				}
@@ -28,6 +28,7 @@
 
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
+#include "engines/wintermute/base/base_engine.h"
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/scriptables/script_engine.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
@@ -48,7 +49,12 @@ ScScript::ScScript(BaseGame *inGame, ScEngine *engine) : BaseClass(inGame) {
 	_currentLine = 0;
 
 	_symbols = nullptr;
+	_symbolAtoms = nullptr;
 	_numSymbols = 0;
+	for (uint i = 0; i < kNameCacheSize; i++) {
+		_nameCache[i]._literal = nullptr;
+	}
+	_lastLiteral = nullptr;
 
 	_engine = engine;
 
@@ -171,10 +177,14 @@ bool ScScript::initTables() {
 
 	_numSymbols = getDWORD();
 	_symbols = new char*[_numSymbols];
+	_symbolAtoms = new ScAtom[_numSymbols];
+	ScAtomTable *atoms = BaseEngine::instance().getAtomTable();
 	for (uint32 i = 0; i < _numSymbols; i++) {
 		uint32 index = getDWORD();
 		_symbols[index] = getString();
+		_symbolAtoms[index] = atoms->acquire(_symbols[index]);
 	}
+	resetNameCache();
 
 	// load functions table
 	_iP = _header.funcTable;
@@ -396,7 +406,16 @@ void ScScript::cleanup() {
 		delete[] _symbols;
 	}
 	_symbols = nullptr;
+	if (_symbolAtoms) {
+		ScAtomTable *atoms = BaseEngine::instance().getAtomTable();
+		for (uint32 i = 0; i < _numSymbols; i++) {
+			atoms->release(_symbolAtoms[i]);
+		}
+		delete[] _symbolAtoms;
+	}
+	_symbolAtoms = nullptr;
 	_numSymbols = 0;
+	resetNameCache();
 
 	if (_globals && !_thread) {
 		delete _globals;
@@ -523,6 +542,10 @@ bool ScScript::executeInstruction() {
 	ScValue *op1;
 	ScValue *op2;
 
+	// Names pushed as literals by the previous instruction can use the name cache
+	const char *literal = _lastLiteral;
+	_lastLiteral = nullptr;
+
 	uint32 inst = getDWORD();
 
 	preInstHook(inst);
@@ -533,9 +556,9 @@ bool ScScript::executeInstruction() {
 		_operand->setNULL();
 		dw = getDWORD();
 		if (_scopeStack->_sP < 0) {
-			_globals->setProp(_symbols[dw], _operand);
+			_globals->setProp(_symbolAtoms[dw], _operand);
 		} else {
-			_scopeStack->getTop()->setProp(_symbols[dw], _operand);
+			_scopeStack->getTop()->setProp(_symbolAtoms[dw], _operand);
 		}
 
 		break;
@@ -545,9 +568,9 @@ bool ScScript::executeInstruction() {
 		dw = getDWORD();
 		/*      char *temp = _symbols[dw]; // TODO delete */
 		// only create global var if it doesn't exist
-		if (!_engine->_globals->propExists(_symbols[dw])) {
+		if (!_engine->_globals->propExists(_symbolAtoms[dw])) {
 			_operand->setNULL();
-			_engine->_globals->setProp(_symbols[dw], _operand, false, inst == II_DEF_CONST_VAR);
+			_engine->_globals->setProp(_symbolAtoms[dw], _operand, false, inst == II_DEF_CONST_VAR);
 		}
 		break;
 	}
@@ -589,8 +612,9 @@ bool ScScript::executeInstruction() {
 		// push var
 		// push string
 		str = _stack->pop()->getString();
-		char *methodName = new char[strlen(str) + 1];
-		strcpy(methodName, str);
+		// Copy the name, the stack value is reused by the call
+		Common::String methodNameStr(str);
+		const char *methodName = methodNameStr.c_str();
 
 		ScValue *var = _stack->pop();
 		if (var->_type == VAL_VARIABLE_REF) {
@@ -624,7 +648,6 @@ bool ScScript::executeInstruction() {
 					runtimeError("Cannot call method '%s'. Ignored.", methodName);
 					_stack->pushNULL();
 				}
-				delete[] methodName;
 				break;
 			}
 			/*
@@ -661,7 +684,6 @@ bool ScScript::executeInstruction() {
 				}
 			}
 		}
-		delete[] methodName;
 	}
 	break;
 
@@ -697,7 +719,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_VAR: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getVar(_symbolAtoms[getDWORD()]);
 		if (false && /*var->_type==VAL_OBJECT ||*/ var->_type == VAL_NATIVE) {
 			_operand->setReference(var);
 			_stack->push(_operand);
@@ -708,15 +730,14 @@ bool ScScript::executeInstruction() {
 	}
 
 	case II_PUSH_VAR_REF: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getVar(_symbolAtoms[getDWORD()]);
 		_operand->setReference(var);
 		_stack->push(_operand);
 		break;
 	}
 
 	case II_POP_VAR: {
-		char *varName = _symbols[getDWORD()];
-		ScValue *var = getVar(varName);
+		ScValue *var = getVar(_symbolAtoms[getDWORD()]);
 		if (var) {
 			ScValue *val = _stack->pop();
 			if (!val) {
@@ -756,7 +777,8 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_STRING:
-		_stack->pushString(getString());
+		_lastLiteral = getString();
+		_stack->pushString(_lastLiteral);
 		break;
 
 	case II_PUSH_NULL:
@@ -769,7 +791,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_THIS:
-		_operand->setReference(getVar(_symbols[getDWORD()]));
+		_operand->setReference(getVar(_symbolAtoms[getDWORD()]));
 		_thisStack->push(_operand);
 		break;
 
@@ -779,7 +801,8 @@ bool ScScript::executeInstruction() {
 
 	case II_PUSH_BY_EXP: {
 		str = _stack->pop()->getString();
-		ScValue *val = _stack->pop()->getProp(str);
+		ScValue *obj = _stack->pop();
+		ScValue *val = literal ? obj->getProp(getLiteralAtom(literal)) : obj->getProp(str);
 		if (val) {
 			_stack->push(val);
 		} else {
@@ -797,6 +820,8 @@ bool ScScript::executeInstruction() {
 		if (val == nullptr) {
 			runtimeError("Script stack corruption detected. Please report this script at WME bug reports forum.");
 			var->setNULL();
+		} else if (literal) {
+			var->setProp(getLiteralAtom(literal), val);
 		} else {
 			var->setProp(str, val);
 		}
@@ -1128,6 +1153,16 @@ uint32 ScScript::getMethodPos(const Common::String &name) const {
 
 //////////////////////////////////////////////////////////////////////////
 ScValue *ScScript::getVar(char *name) {
+	ScAtomTable *atoms = BaseEngine::instance().getAtomTable();
+	ScAtom atom = atoms->acquire(name);
+	ScValue *ret = getVar(atom);
+	atoms->release(atom);
+	return ret;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScScript::getVar(ScAtom name) {
 	ScValue *ret = nullptr;
 
 	// scope locals
@@ -1153,7 +1188,7 @@ ScValue *ScScript::getVar(char *name) {
 
 	if (ret == nullptr) {
 		//RuntimeError("Variable '%s' is inaccessible in the current block. Consider changing the script.", name);
-		_gameRef->LOG(0, "Warning: variable '%s' is inaccessible in the current block. Consider changing the script (script:%s, line:%d)", name, _filename, _currentLine);
+		_gameRef->LOG(0, "Warning: variable '%s' is inaccessible in the current block. Consider changing the script (script:%s, line:%d)", ScValue::getAtomName(name).c_str(), _filename, _currentLine);
 		ScValue *val = new ScValue(_gameRef);
 		ScValue *scope = _scopeStack->getTop();
 		if (scope) {
@@ -1170,6 +1205,36 @@ ScValue *ScScript::getVar(char *name) {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+ScAtom ScScript::getLiteralAtom(const char *literal) {
+	NameCacheEntry &entry = _nameCache[((size_t)literal >> 2) % kNameCacheSize];
+	if (entry._literal == literal) {
+		return entry._atom;
+	}
+
+	ScAtomTable *atoms = BaseEngine::instance().getAtomTable();
+	if (entry._literal) {
+		atoms->release(entry._atom);
+	}
+	entry._literal = literal;
+	entry._atom = atoms->acquire(literal);
+	return entry._atom;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void ScScript::resetNameCache() {
+	ScAtomTable *atoms = BaseEngine::instance().getAtomTable();
+	for (uint i = 0; i < kNameCacheSize; i++) {
+		if (_nameCache[i]._literal) {
+			atoms->release(_nameCache[i]._atom);
+			_nameCache[i]._literal = nullptr;
+		}
+	}
+	_lastLiteral = nullptr;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 bool ScScript::waitFor(BaseObject *object) {
 	if (_unbreakable) {
@@ -32,6 +32,7 @@
 
 #include "engines/wintermute/base/base.h"
 #include "engines/wintermute/base/scriptables/dcscript.h"   // Added by ClassView
+#include "engines/wintermute/base/scriptables/script_atom_table.h"
 #include "engines/wintermute/coll_templ.h"
 #include "engines/wintermute/persistent.h"
 
@@ -153,6 +154,26 @@ public:
 private:
 	char **_symbols;
 	uint32 _numSymbols;
+	/** Atoms of the symbol names, resolved when the tables are loaded */
+	ScAtom *_symbolAtoms;
+	ScValue *getVar(ScAtom name);
+
+	/**
+	 * Atoms of property names pushed as string literals, cached by the
+	 * address of the literal in the script buffer. Literals never change,
+	 * so a hit only compares pointers. Each entry holds a reference to its
+	 * atom, computed names are never cached.
+	 */
+	struct NameCacheEntry {
+		const char *_literal;
+		ScAtom _atom;
+	};
+	static const uint kNameCacheSize = 64;
+	NameCacheEntry _nameCache[kNameCacheSize];
+	/** The literal pushed by the last instruction, if it was II_PUSH_STRING */
+	const char *_lastLiteral;
+	ScAtom getLiteralAtom(const char *literal);
+	void resetNameCache();
 	TFunctionPos *_functions;
 	TMethodPos *_methods;
 	TEventPos *_events;
@@ -0,0 +1,91 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "engines/wintermute/base/scriptables/script_atom_table.h"
+
+namespace Wintermute {
+
+ScAtomTable::ScAtomTable() {
+}
+
+ScAtomTable::~ScAtomTable() {
+	for (uint i = 0; i < _entries.size(); i++) {
+		delete _entries[i]._name;
+	}
+}
+
+ScAtom ScAtomTable::acquire(const char *name) {
+	return acquire(Common::String(name));
+}
+
+ScAtom ScAtomTable::acquire(const Common::String &name) {
+	Common::HashMap<Common::String, ScAtom>::const_iterator it = _atoms.find(name);
+	if (it != _atoms.end()) {
+		_entries[it->_value]._refCount++;
+		return it->_value;
+	}
+
+	ScAtom atom;
+	if (!_freeAtoms.empty()) {
+		atom = _freeAtoms.back();
+		_freeAtoms.pop_back();
+	} else {
+		atom = _entries.size();
+		Entry entry;
+		entry._name = nullptr;
+		entry._refCount = 0;
+		_entries.push_back(entry);
+	}
+
+	_entries[atom]._name = new Common::String(name);
+	_entries[atom]._refCount = 1;
+	_atoms[name] = atom;
+	return atom;
+}
+
+void ScAtomTable::addRef(ScAtom atom) {
+	assert(atom < _entries.size() && _entries[atom]._refCount > 0);
+	_entries[atom]._refCount++;
+}
+
+void ScAtomTable::release(ScAtom atom) {
+	assert(atom < _entries.size() && _entries[atom]._refCount > 0);
+	if (--_entries[atom]._refCount > 0) {
+		return;
+	}
+
+	_atoms.erase(*_entries[atom]._name);
+	delete _entries[atom]._name;
+	_entries[atom]._name = nullptr;
+	_freeAtoms.push_back(atom);
+}
+
+bool ScAtomTable::find(const char *name, ScAtom &atom) const {
+	Common::HashMap<Common::String, ScAtom>::const_iterator it = _atoms.find(name);
+	if (it == _atoms.end()) {
+		return false;
+	}
+	atom = it->_value;
+	return true;
+}
+
+} // End of namespace Wintermute
@@ -0,0 +1,83 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef WINTERMUTE_SCRIPT_ATOM_TABLE_H
+#define WINTERMUTE_SCRIPT_ATOM_TABLE_H
+
+#include "common/array.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/str.h"
+
+namespace Wintermute {
+
+/** An interned identifier, see ScAtomTable. */
+typedef uint32 ScAtom;
+
+/**
+ * Interns the names of script variables and object properties.
+ *
+ * Every distinct name is assigned a small integer, so that the script
+ * engine can look up properties by integer instead of hashing and comparing
+ * strings on each access.
+ *
+ * Atoms are reference counted: script symbol tables and object properties
+ * keep a reference to the atoms they use, and an atom is freed, and its
+ * number reused, once the last reference is released. Names that are only
+ * looked up go through find(), which never creates an atom, so computed
+ * keys don't pile up in the table.
+ */
+class ScAtomTable {
+public:
+	ScAtomTable();
+	~ScAtomTable();
+
+	/** Get the atom for a name and add a reference to it, assigning a new atom if the name is new. */
+	ScAtom acquire(const char *name);
+	ScAtom acquire(const Common::String &name);
+	/** Add a reference to an atom that is already in use. */
+	void addRef(ScAtom atom);
+	/** Drop a reference, freeing the atom when it was the last one. */
+	void release(ScAtom atom);
+	/** Look up the atom of a name without creating one. */
+	bool find(const char *name, ScAtom &atom) const;
+
+	/** The name of an atom, valid for as long as the atom is referenced. */
+	const Common::String &getName(ScAtom atom) const { return *_entries[atom]._name; }
+	uint getNumAtoms() const { return _atoms.size(); }
+
+private:
+	struct Entry {
+		/** Stored by pointer, so references to it survive growing the array */
+		Common::String *_name;
+		uint32 _refCount;
+	};
+
+	Common::HashMap<Common::String, ScAtom> _atoms;
+	Common::Array<Entry> _entries;
+	/** Numbers of freed atoms, reused before the table grows */
+	Common::Array<ScAtom> _freeAtoms;
+};
+
+} // End of namespace Wintermute
+
+#endif
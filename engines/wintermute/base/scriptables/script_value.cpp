@@ -28,6 +28,7 @@
 
 #include "engines/wintermute/platform_osystem.h"
 #include "engines/wintermute/base/base_dynamic_buffer.h"
+#include "engines/wintermute/base/base_engine.h"
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
@@ -157,13 +158,56 @@ ScValue::~ScValue() {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+ScAtomTable *ScValue::getAtomTable() {
+	return BaseEngine::instance().getAtomTable();
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+const Common::String &ScValue::getAtomName(ScAtom atom) {
+	return getAtomTable()->getName(atom);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void ScValue::storeProp(ScAtom name, ScValue *val) {
+	_valIter = _valObject.find(name);
+	if (_valIter != _valObject.end()) {
+		_valIter->_value = val;
+	} else {
+		// Each key holds a reference to its atom
+		getAtomTable()->addRef(name);
+		_valObject[name] = val;
+	}
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 ScValue *ScValue::getProp(const char *name) {
+	// Only look the name up, reading a computed key must not create an atom.
+	// A name without an atom can't be the key of any property.
+	ScAtom atom;
+	if (getAtomTable()->find(name, atom)) {
+		return lookupProp(getAtomName(atom), &atom);
+	}
+	return lookupProp(Common::String(name), nullptr);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScValue::getProp(ScAtom name) {
+	return lookupProp(getAtomName(name), &name);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScValue::lookupProp(const Common::String &name, const ScAtom *atom) {
 	if (_type == VAL_VARIABLE_REF) {
-		return _valRef->getProp(name);
+		return _valRef->lookupProp(name, atom);
 	}
 
-	if (_type == VAL_STRING && strcmp(name, "Length") == 0) {
+	if (_type == VAL_STRING && name == "Length") {
 		_gameRef->_scValue->_type = VAL_INT;
 
 		if (_gameRef->_textEncoding == TEXT_ANSI) {
@@ -182,8 +226,8 @@ ScValue *ScValue::getProp(const char *name) {
 		ret = _valNative->scGetProperty(name);
 	}
 
-	if (ret == nullptr) {
-		_valIter = _valObject.find(name);
+	if (ret == nullptr && atom) {
+		_valIter = _valObject.find(*atom);
 		if (_valIter != _valObject.end()) {
 			ret = _valIter->_value;
 		}
@@ -193,6 +237,16 @@ ScValue *ScValue::getProp(const char *name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::deleteProp(const char *name) {
+	ScAtom atom;
+	if (!getAtomTable()->find(name, atom)) {
+		return STATUS_OK;
+	}
+	return deleteProp(atom);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool ScValue::deleteProp(ScAtom name) {
 	if (_type == VAL_VARIABLE_REF) {
 		return _valRef->deleteProp(name);
 	}
@@ -210,13 +264,23 @@ bool ScValue::deleteProp(const char *name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAsConst) {
+	// The new property takes its own reference, so the atom lives exactly as long as it is used
+	ScAtom atom = getAtomTable()->acquire(name);
+	bool ret = setProp(atom, val, copyWhole, setAsConst);
+	getAtomTable()->release(atom);
+	return ret;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool ScValue::setProp(ScAtom name, ScValue *val, bool copyWhole, bool setAsConst) {
 	if (_type == VAL_VARIABLE_REF) {
 		return _valRef->setProp(name, val);
 	}
 
 	bool ret = STATUS_FAILED;
 	if (_type == VAL_NATIVE && _valNative) {
-		ret = _valNative->scSetProperty(name, val);
+		ret = _valNative->scSetProperty(getAtomName(name).c_str(), val);
 	}
 
 	if (DID_FAIL(ret)) {
@@ -234,7 +298,7 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 
 		newVal->copy(val, copyWhole);
 		newVal->_isConstVar = setAsConst;
-		_valObject[name] = newVal;
+		storeProp(name, newVal);
 
 		if (_type != VAL_NATIVE) {
 			_type = VAL_OBJECT;
@@ -261,6 +325,16 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::propExists(const char *name) {
+	ScAtom atom;
+	if (!getAtomTable()->find(name, atom)) {
+		return false;
+	}
+	return propExists(atom);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool ScValue::propExists(ScAtom name) {
 	if (_type == VAL_VARIABLE_REF) {
 		return _valRef->propExists(name);
 	}
@@ -272,9 +346,19 @@ bool ScValue::propExists(const char *name) {
 
 //////////////////////////////////////////////////////////////////////////
 void ScValue::deleteProps() {
+	clearProps(true);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void ScValue::clearProps(bool deleteValues) {
+	ScAtomTable *atoms = getAtomTable();
 	_valIter = _valObject.begin();
 	while (_valIter != _valObject.end()) {
-		delete(ScValue *)_valIter->_value;
+		if (deleteValues) {
+			delete(ScValue *)_valIter->_value;
+		}
+		atoms->release(_valIter->_key);
 		_valIter++;
 	}
 	_valObject.clear();
@@ -743,12 +827,13 @@ void ScValue::copy(ScValue *orig, bool copyWhole) {
 	if (orig->_type == VAL_OBJECT && orig->_valObject.size() > 0) {
 		orig->_valIter = orig->_valObject.begin();
 		while (orig->_valIter != orig->_valObject.end()) {
-			_valObject[orig->_valIter->_key] = new ScValue(_gameRef);
-			_valObject[orig->_valIter->_key]->copy(orig->_valIter->_value);
+			ScValue *val = new ScValue(_gameRef);
+			val->copy(orig->_valIter->_value);
+			storeProp(orig->_valIter->_key, val);
 			orig->_valIter++;
 		}
 	} else {
-		_valObject.clear();
+		clearProps(false);
 	}
 }
 
@@ -806,7 +891,7 @@ bool ScValue::persist(BasePersistenceManager *persistMgr) {
 		persistMgr->transferSint32("", &size);
 		_valIter = _valObject.begin();
 		while (_valIter != _valObject.end()) {
-			str = _valIter->_key.c_str();
+			str = getAtomName(_valIter->_key).c_str();
 			persistMgr->transferConstChar("", &str);
 			persistMgr->transferPtr("", &_valIter->_value);
 
@@ -819,7 +904,9 @@ bool ScValue::persist(BasePersistenceManager *persistMgr) {
 			persistMgr->transferConstChar("", &str);
 			persistMgr->transferPtr("", &val);
 
-			_valObject[str] = val;
+			ScAtom atom = getAtomTable()->acquire(str);
+			storeProp(atom, val);
+			getAtomTable()->release(atom);
 			delete[] str;
 		}
 	}
@@ -887,7 +974,7 @@ bool ScValue::saveAsText(BaseDynamicBuffer *buffer, int indent) {
 	_valIter = _valObject.begin();
 	while (_valIter != _valObject.end()) {
 		buffer->putTextIndent(indent, "PROPERTY {\n");
-		buffer->putTextIndent(indent + 2, "NAME=\"%s\"\n", _valIter->_key.c_str());
+		buffer->putTextIndent(indent + 2, "NAME=\"%s\"\n", getAtomName(_valIter->_key).c_str());
 		buffer->putTextIndent(indent + 2, "VALUE=\"%s\"\n", _valIter->_value->getString());
 		buffer->putTextIndent(indent, "}\n\n");
 
@@ -33,6 +33,7 @@
 #include "engines/wintermute/base/base.h"
 #include "engines/wintermute/persistent.h"
 #include "engines/wintermute/base/scriptables/dcscript.h"   // Added by ClassView
+#include "engines/wintermute/base/scriptables/script_atom_table.h"
 #include "common/str.h"
 
 namespace Wintermute {
@@ -53,6 +54,7 @@ public:
 	void setValue(ScValue *val);
 	bool _persistent;
 	bool propExists(const char *name);
+	bool propExists(ScAtom name);
 	void copy(ScValue *orig, bool copyWhole = false);
 	void setStringVal(const char *val);
 	TValType getType();
@@ -63,6 +65,7 @@ public:
 	void *getMemBuffer();
 	BaseScriptable *getNative();
 	bool deleteProp(const char *name);
+	bool deleteProp(ScAtom name);
 	void deleteProps();
 	void CleanProps(bool includingNatives);
 	void setBool(bool val);
@@ -82,7 +85,17 @@ public:
 	bool isInt();
 	bool isObject();
 	bool setProp(const char *name, ScValue *val, bool copyWhole = false, bool setAsConst = false);
+	bool setProp(ScAtom name, ScValue *val, bool copyWhole = false, bool setAsConst = false);
 	ScValue *getProp(const char *name);
+	ScValue *getProp(ScAtom name);
+private:
+	/** Property lookup by name, atom is null for names that have none */
+	ScValue *lookupProp(const Common::String &name, const ScAtom *atom);
+	/** Sets a property, adding a reference to the atom for a new key */
+	void storeProp(ScAtom name, ScValue *val);
+	/** Removes all properties, releasing the references held by their keys */
+	void clearProps(bool deleteValues);
+public:
 	BaseScriptable *_valNative;
 	ScValue *_valRef;
 private:
@@ -98,8 +111,12 @@ public:
 	ScValue(BaseGame *inGame, double Val);
 	ScValue(BaseGame *inGame, const char *Val);
 	virtual ~ScValue();
-	Common::HashMap<Common::String, ScValue *> _valObject;
-	Common::HashMap<Common::String, ScValue *>::iterator _valIter;
+	/** Properties, keyed by the atoms of their names */
+	Common::HashMap<ScAtom, ScValue *> _valObject;
+	Common::HashMap<ScAtom, ScValue *>::iterator _valIter;
+
+	static ScAtomTable *getAtomTable();
+	static const Common::String &getAtomName(ScAtom atom);
 
 	bool setProperty(const char *propName, int32 value);
 	bool setProperty(const char *propName, const char *value);
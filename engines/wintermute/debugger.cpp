@@ -23,7 +23,11 @@
 #include "engines/wintermute/debugger.h"
 #include "engines/wintermute/base/base_engine.h"
 #include "engines/wintermute/base/base_file_manager.h"
+#include "engines/wintermute/base/base_game.h"
+#include "engines/wintermute/base/file/package_entry_cache.h"
+#include "engines/wintermute/base/gfx/osystem/base_render_osystem.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
+#include "engines/wintermute/system/sys_class_registry.h"
 #include "engines/wintermute/debugger/debugger_controller.h"
 #include "engines/wintermute/wintermute.h"
 
@@ -36,6 +40,9 @@ Console::Console(WintermuteEngine *vm) : GUI::Debugger(), _engineRef(vm) {
 	registerCmd("dump_file", WRAP_METHOD(Console, Cmd_DumpFile));
 	registerCmd("show_fps", WRAP_METHOD(Console, Cmd_ShowFps));
 	registerCmd("dump_file", WRAP_METHOD(Console, Cmd_DumpFile));
+	registerCmd("surface_cache", WRAP_METHOD(Console, Cmd_SurfaceCache));
+	registerCmd("package_cache", WRAP_METHOD(Console, Cmd_PackageCache));
+	registerCmd("save_stats", WRAP_METHOD(Console, Cmd_SaveStats));
 	registerCmd("help", WRAP_METHOD(Console, Cmd_Help));
 	// Actual (script) debugger commands
 	registerCmd(STEP_CMD, WRAP_METHOD(Console, Cmd_Step));
@@ -341,6 +348,90 @@ bool Console::Cmd_DumpFile(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::Cmd_SurfaceCache(int argc, const char **argv) {
+	if (argc > 2) {
+		debugPrintf("Usage: %s [reset|flush]\n", argv[0]);
+		return true;
+	}
+	if (!_engineRef->_game || !_engineRef->_game->_renderer) {
+		debugPrintf("No renderer\n");
+		return true;
+	}
+
+	BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_engineRef->_game->_renderer);
+	TransformedSurfaceCache *cache = renderer->getSurfaceCache();
+	const TransformedSurfaceCache::Stats &stats = cache->getStats();
+	uint32 lookups = stats.hits + stats.misses;
+	debugPrintf("Entries: %d (%d KB, peak %d KB)\n", cache->getNumEntries(), stats.bytes / 1024, stats.peakBytes / 1024);
+	debugPrintf("Lookups: %d, hits: %d (%d%%), misses: %d (%d transformed)\n", lookups, stats.hits,
+		lookups ? stats.hits * 100 / lookups : 0, stats.misses, stats.transformed);
+	debugPrintf("Evictions: %d, invalidations: %d\n", stats.evictions, stats.invalidations);
+
+	if (argc == 2) {
+		if (!strcmp(argv[1], "reset")) {
+			cache->resetStats();
+			debugPrintf("Statistics reset\n");
+		} else if (!strcmp(argv[1], "flush")) {
+			cache->flush();
+			debugPrintf("Unused entries freed\n");
+		} else {
+			debugPrintf("Usage: %s [reset|flush]\n", argv[0]);
+		}
+	}
+	return true;
+}
+
+bool Console::Cmd_PackageCache(int argc, const char **argv) {
+	if (argc > 2) {
+		debugPrintf("Usage: %s [reset|flush]\n", argv[0]);
+		return true;
+	}
+	BaseFileManager *fileManager = BaseEngine::instance().getFileManager();
+	if (!fileManager || !fileManager->getEntryCache()) {
+		debugPrintf("No file manager\n");
+		return true;
+	}
+
+	PackageEntryCache *cache = fileManager->getEntryCache();
+	const PackageEntryCache::Stats &stats = cache->getStats();
+	uint32 lookups = stats.hits + stats.misses;
+	debugPrintf("Entries: %d (%d KB, peak %d KB)\n", cache->getNumEntries(), stats.bytes / 1024, stats.peakBytes / 1024);
+	debugPrintf("Lookups: %d, hits: %d (%d%%), misses: %d\n", lookups, stats.hits,
+		lookups ? stats.hits * 100 / lookups : 0, stats.misses);
+	debugPrintf("Evictions: %d\n", stats.evictions);
+
+	if (argc == 2) {
+		if (!strcmp(argv[1], "reset")) {
+			cache->resetStats();
+			debugPrintf("Statistics reset\n");
+		} else if (!strcmp(argv[1], "flush")) {
+			cache->flush();
+			debugPrintf("Entries freed\n");
+		} else {
+			debugPrintf("Usage: %s [reset|flush]\n", argv[0]);
+		}
+	}
+	return true;
+}
+
+bool Console::Cmd_SaveStats(int argc, const char **argv) {
+	const SystemClassRegistry::SaveStats &stats = SystemClassRegistry::getInstance()->getLastSaveStats();
+	if (stats.empty()) {
+		debugPrintf("No game saved yet\n");
+		return true;
+	}
+
+	uint32 totalBytes = 0;
+	uint32 totalMillis = 0;
+	for (uint32 i = 0; i < stats.size(); i++) {
+		debugPrintf("%-24s %6d instance(s) %9d bytes %5d ms\n", stats[i]._name.c_str(), stats[i]._numInstances, stats[i]._bytes, stats[i]._millis);
+		totalBytes += stats[i]._bytes;
+		totalMillis += stats[i]._millis;
+	}
+	debugPrintf("Total: %d classes, %d bytes, %d ms\n", stats.size(), totalBytes, totalMillis);
+	return true;
+}
+
 
 bool Console::Cmd_SourcePath(int argc, const char **argv) {
 	if (argc != 2) {
@@ -70,6 +70,18 @@ public:
 	bool Cmd_Help(int argc, const char **argv);
 	bool Cmd_ShowFps(int argc, const char **argv);
 	bool Cmd_DumpFile(int argc, const char **argv);
+	/**
+	 * Show render ticket surface cache statistics,
+	 * optionally resetting them or freeing unused entries.
+	 */
+	bool Cmd_SurfaceCache(int argc, const char **argv);
+	/**
+	 * Show decompressed package entry cache statistics,
+	 * optionally resetting them or freeing all entries.
+	 */
+	bool Cmd_PackageCache(int argc, const char **argv);
+	/** Show what each class cost in the last save. */
+	bool Cmd_SaveStats(int argc, const char **argv);
 
 #if EXTENDED_DEBUGGER_ENABLED
 	/**
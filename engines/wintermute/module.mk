@@ -30,6 +30,7 @@ MODULE_OBJS := \
 	base/scriptables/debuggable/debuggable_script.o \
 	base/scriptables/debuggable/debuggable_script_engine.o \
 	base/scriptables/script.o \
+	base/scriptables/script_atom_table.o \
 	base/scriptables/script_engine.o \
 	base/scriptables/script_stack.o \
 	base/scriptables/script_value.o \
@@ -45,6 +46,7 @@ MODULE_OBJS := \
 	base/file/base_file.o \
 	base/file/base_file_entry.o \
 	base/file/base_package.o \
+	base/file/package_entry_cache.o \
 	base/file/base_save_thumb_file.o \
 	base/file/base_savefile_manager_file.o \
 	base/font/base_font_bitmap.o \
@@ -56,7 +58,9 @@ MODULE_OBJS := \
 	base/gfx/base_surface.o \
 	base/gfx/osystem/base_surface_osystem.o \
 	base/gfx/osystem/base_render_osystem.o \
+	base/gfx/osystem/dirty_rect_container.o \
 	base/gfx/osystem/render_ticket.o \
+	base/gfx/osystem/transformed_surface_cache.o \
 	base/particles/part_particle.o \
 	base/particles/part_emitter.o \
 	base/particles/part_force.o \
@@ -34,7 +34,10 @@
 #include "engines/wintermute/system/sys_class_registry.h"
 #include "engines/wintermute/system/sys_class.h"
 #include "engines/wintermute/wintermute.h"
+#include "common/algorithm.h"
+#include "common/debug.h"
 #include "common/stream.h"
+#include "common/system.h"
 
 namespace Wintermute {
 
@@ -262,6 +265,7 @@ bool SystemClassRegistry::saveInstances(BaseGame *gameRef, BasePersistenceManage
 
 	persistMgr->putDWORD(numInstances);
 
+	_lastSaveStats.clear();
 	int counter = 0;
 	for (it = _classes.begin(); it != _classes.end(); ++it) {
 		counter++;
@@ -273,12 +277,38 @@ bool SystemClassRegistry::saveInstances(BaseGame *gameRef, BasePersistenceManage
 		}
 		gameRef->miniUpdate();
 
+		uint32 startTime = g_system->getMillis();
+		uint32 startSize = persistMgr->getSaveSize();
 		(it->_value)->saveInstances(gameRef,  persistMgr);
+
+		if ((it->_value)->getNumInstances()) {
+			ClassSaveStats stats;
+			stats._name = (it->_value)->getName();
+			stats._numInstances = (it->_value)->getNumInstances();
+			stats._bytes = persistMgr->getSaveSize() - startSize;
+			stats._millis = g_system->getMillis() - startTime;
+			_lastSaveStats.push_back(stats);
+		}
+	}
+
+	Common::sort(_lastSaveStats.begin(), _lastSaveStats.end(), compareSaveStats);
+	for (uint32 i = 0; i < _lastSaveStats.size() && i < 5; i++) {
+		debugC(kWintermuteDebugSaveGame, "  %s: %d instance(s), %d bytes, %d ms", _lastSaveStats[i]._name.c_str(),
+			_lastSaveStats[i]._numInstances, _lastSaveStats[i]._bytes, _lastSaveStats[i]._millis);
 	}
 
 	return STATUS_OK;
 }
 
+//////////////////////////////////////////////////////////////////////////
+bool SystemClassRegistry::compareSaveStats(const ClassSaveStats &a, const ClassSaveStats &b) {
+	// Most classes save in well under a millisecond, so the size breaks ties
+	if (a._millis != b._millis) {
+		return a._millis > b._millis;
+	}
+	return a._bytes > b._bytes;
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool SystemClassRegistry::loadInstances(BaseGame *gameRef, BasePersistenceManager *persistMgr) {
 	// get total instances
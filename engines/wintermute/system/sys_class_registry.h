@@ -32,6 +32,7 @@
 #include "engines/wintermute/wintypes.h"
 #include "engines/wintermute/dctypes.h"
 #include "engines/wintermute/system/sys_class.h"
+#include "common/array.h"
 #include "common/hashmap.h"
 #include "common/hash-str.h"
 #include "common/func.h"
@@ -81,6 +82,17 @@ public:
 	int getNextID();
 	void addInstanceToTable(SystemInstance *instance, void *pointer);
 
+	/** What saving the instances of one class cost in the last save */
+	struct ClassSaveStats {
+		AnsiString _name;
+		uint32 _numInstances;
+		uint32 _bytes;
+		uint32 _millis;
+	};
+	typedef Common::Array<ClassSaveStats> SaveStats;
+	/** Per-class cost of the last save, most expensive first */
+	const SaveStats &getLastSaveStats() const { return _lastSaveStats; }
+
 	bool _disabled;
 	int _count;
 
@@ -99,6 +111,10 @@ public:
 	typedef Common::HashMap<int, SystemInstance *> SavedInstanceMap;
 	SavedInstanceMap _savedInstanceMap;
 
+private:
+	static bool compareSaveStats(const ClassSaveStats &a, const ClassSaveStats &b);
+	SaveStats _lastSaveStats;
+
 };
 
 } // End of namespace Wintermute
@@ -116,6 +116,7 @@ void RenderManager::renderSceneToScreen() {
 	RenderTable::RenderState state = _renderTable.getRenderState();
 	if (state == RenderTable::PANORAMA || state == RenderTable::TILT) {
 		if (!_backgroundSurfaceDirtyRect.isEmpty()) {
+			_renderTable.setHighQuality(_engine->getScriptManager()->getStateValue(StateKey_HighQuality) != 0);
 			_renderTable.mutateImage(&_warpedSceneSurface, in);
 			out = &_warpedSceneSurface;
 			outWndDirtyRect = Common::Rect(_workingWindow.width(), _workingWindow.height());
@@ -25,17 +25,29 @@
 #include "common/math.h"
 #include "common/rect.h"
 #include "common/scummsys.h"
+#include "common/textconsole.h"
 #include "graphics/colormasks.h"
 
 namespace ZVision {
 
+// Subpixel precision of the lookup table. Five bits keep every channel of a
+// blended RGB555 pixel within its own bit range (see expand555()).
+static const uint kSubpixelBits = 5;
+static const uint kSubpixelScale = 1 << kSubpixelBits;
+
 RenderTable::RenderTable(uint numColumns, uint numRows)
 	: _numRows(numRows),
 	  _numColumns(numColumns),
-	  _renderState(FLAT) {
+	  _renderState(FLAT),
+	  _highQuality(true),
+	  _generatedState(FLAT),
+	  _generatedFoV(0.0f),
+	  _generatedScale(0.0f) {
 	assert(numRows != 0 && numColumns != 0);
 
 	_internalBuffer = new Common::Point[numRows * numColumns];
+	_fractionBuffer = new uint16[numRows * numColumns];
+	memset(_fractionBuffer, 0, numRows * numColumns * sizeof(uint16));
 
 	memset(&_panoramaOptions, 0, sizeof(_panoramaOptions));
 	memset(&_tiltOptions, 0, sizeof(_tiltOptions));
@@ -43,6 +55,7 @@ RenderTable::RenderTable(uint numColumns, uint numRows)
 
 RenderTable::~RenderTable() {
 	delete[] _internalBuffer;
+	delete[] _fractionBuffer;
 }
 
 void RenderTable::setRenderState(RenderState newState) {
@@ -105,28 +118,140 @@ void RenderTable::mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 d
 }
 
 void RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf) {
-	uint32 destOffset = 0;
+	assert(srcBuf->format == dstBuf->format);
+	assert((uint)srcBuf->w <= _numColumns && (uint)srcBuf->h <= _numRows);
+
+	const uint bpp = srcBuf->format.bytesPerPixel;
+	const uint32 sourcePitch = srcBuf->pitch / bpp;
+	const uint32 destPitch = dstBuf->pitch / bpp;
+
+	if (bpp == 2) {
+		const uint16 *sourceBuffer = (const uint16 *)srcBuf->getPixels();
+		uint16 *destBuffer = (uint16 *)dstBuf->getPixels();
+
+		if (_highQuality && srcBuf->format == Graphics::PixelFormat(2, 5, 5, 5, 0, 10, 5, 0, 0))
+			mutateImageBilinear555(sourceBuffer, destBuffer, sourcePitch, destPitch, srcBuf->w, srcBuf->h);
+		else
+			mutateImageNearest(sourceBuffer, destBuffer, sourcePitch, destPitch, srcBuf->w, srcBuf->h);
+	} else if (bpp == 4) {
+		const uint32 *sourceBuffer = (const uint32 *)srcBuf->getPixels();
+		uint32 *destBuffer = (uint32 *)dstBuf->getPixels();
+
+		if (_highQuality)
+			mutateImageBilinear8888(sourceBuffer, destBuffer, sourcePitch, destPitch, srcBuf->w, srcBuf->h);
+		else
+			mutateImageNearest(sourceBuffer, destBuffer, sourcePitch, destPitch, srcBuf->w, srcBuf->h);
+	} else {
+		error("RenderTable: Unsupported pixel depth %d", bpp);
+	}
+}
 
-	uint16 *sourceBuffer = (uint16 *)srcBuf->getPixels();
-	uint16 *destBuffer = (uint16 *)dstBuf->getPixels();
+template<typename Pixel>
+void RenderTable::mutateImageNearest(const Pixel *sourceBuffer, Pixel *destBuffer, uint32 sourcePitch, uint32 destPitch, uint16 width, uint16 height) {
+	for (uint y = 0; y < height; ++y) {
+		const Common::Point *offset = &_internalBuffer[y * _numColumns];
+		Pixel *dest = destBuffer + y * destPitch;
 
-	for (int16 y = 0; y < srcBuf->h; ++y) {
-		uint32 sourceOffset = y * _numColumns;
+		for (uint x = 0; x < width; ++x) {
+			// RenderTable only stores offsets from the original coordinates
+			dest[x] = sourceBuffer[(y + offset[x].y) * sourcePitch + x + offset[x].x];
+		}
+	}
+}
 
-		for (int16 x = 0; x < srcBuf->w; ++x) {
-			uint32 index = sourceOffset + x;
+/**
+ * Spreads the channels of an RGB555 pixel apart, so that they can be
+ * scaled by up to kSubpixelScale and summed without overlapping:
+ * blue ends up in bits 0-4, red in bits 10-14 and green in bits 21-25.
+ */
+static inline uint32 expand555(uint16 pixel) {
+	return (pixel | (pixel << 16)) & 0x03E07C1F;
+}
 
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
+static inline uint16 compact555(uint32 pixel) {
+	return (pixel & 0x7C1F) | ((pixel >> 16) & 0x03E0);
+}
+
+static inline uint32 lerp555(uint32 a, uint32 b, uint weight) {
+	return ((a * (kSubpixelScale - weight) + b * weight) >> kSubpixelBits) & 0x03E07C1F;
+}
+
+void RenderTable::mutateImageBilinear555(const uint16 *sourceBuffer, uint16 *destBuffer, uint32 sourcePitch, uint32 destPitch, uint16 width, uint16 height) {
+	for (uint y = 0; y < height; ++y) {
+		const Common::Point *offset = &_internalBuffer[y * _numColumns];
+		const uint16 *fraction = &_fractionBuffer[y * _numColumns];
+		uint16 *dest = destBuffer + y * destPitch;
+
+		for (uint x = 0; x < width; ++x) {
+			const uint16 *src = sourceBuffer + (y + offset[x].y) * sourcePitch + x + offset[x].x;
+
+			if (!fraction[x]) {
+				dest[x] = *src;
+				continue;
+			}
+
+			// The table zeroes the fraction at the right and bottom edges,
+			// so the neighbours are never read from outside the image
+			const uint fracX = fraction[x] & 0xFF;
+			const uint fracY = fraction[x] >> 8;
+			const uint32 stepX = fracX ? 1 : 0;
+			const uint32 stepY = fracY ? sourcePitch : 0;
+
+			uint32 top = lerp555(expand555(src[0]), expand555(src[stepX]), fracX);
+			uint32 bottom = lerp555(expand555(src[stepY]), expand555(src[stepY + stepX]), fracX);
+
+			dest[x] = compact555(lerp555(top, bottom, fracY));
+		}
+	}
+}
+
+static inline uint32 lerp8888(uint32 a, uint32 b, uint weight) {
+	// Blend two 8-bit channels per multiplication
+	uint32 rb = ((a & 0x00FF00FF) * (kSubpixelScale - weight) + (b & 0x00FF00FF) * weight) >> kSubpixelBits;
+	uint32 ag = (((a >> 8) & 0x00FF00FF) * (kSubpixelScale - weight) + ((b >> 8) & 0x00FF00FF) * weight) >> kSubpixelBits;
+
+	return (rb & 0x00FF00FF) | ((ag & 0x00FF00FF) << 8);
+}
 
-			destBuffer[destOffset] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
-			destOffset++;
+void RenderTable::mutateImageBilinear8888(const uint32 *sourceBuffer, uint32 *destBuffer, uint32 sourcePitch, uint32 destPitch, uint16 width, uint16 height) {
+	for (uint y = 0; y < height; ++y) {
+		const Common::Point *offset = &_internalBuffer[y * _numColumns];
+		const uint16 *fraction = &_fractionBuffer[y * _numColumns];
+		uint32 *dest = destBuffer + y * destPitch;
+
+		for (uint x = 0; x < width; ++x) {
+			const uint32 *src = sourceBuffer + (y + offset[x].y) * sourcePitch + x + offset[x].x;
+
+			if (!fraction[x]) {
+				dest[x] = *src;
+				continue;
+			}
+
+			const uint fracX = fraction[x] & 0xFF;
+			const uint fracY = fraction[x] >> 8;
+			const uint32 stepX = fracX ? 1 : 0;
+			const uint32 stepY = fracY ? sourcePitch : 0;
+
+			uint32 top = lerp8888(src[0], src[stepX], fracX);
+			uint32 bottom = lerp8888(src[stepY], src[stepY + stepX], fracX);
+
+			dest[x] = lerp8888(top, bottom, fracY);
 		}
 	}
 }
 
 void RenderTable::generateRenderTable() {
+	// Scene changes usually reload the same view parameters, so only
+	// recompute the lookup table when they actually differ
+	float fov = getAngle();
+	float scale = getLinscale();
+	if (_renderState == _generatedState && fov == _generatedFoV && scale == _generatedScale)
+		return;
+
+	_generatedState = _renderState;
+	_generatedFoV = fov;
+	_generatedScale = scale;
+
 	switch (_renderState) {
 	case ZVision::RenderTable::PANORAMA:
 		generatePanoramaLookupTable();
@@ -140,15 +265,30 @@ void RenderTable::generateRenderTable() {
 	}
 }
 
-void RenderTable::generatePanoramaLookupTable() {
-	for (uint y = 0; y < _numRows; y++) {
-		for (uint x = 0; x < _numColumns; x++) {
-			uint32 index = y * _numColumns + x;
-			_internalBuffer[index].x = 0;
-			_internalBuffer[index].y = 0;
-		}
-	}
+void RenderTable::setSourceCoord(uint x, uint y, float sourceX, float sourceY) {
+	uint32 index = y * _numColumns + x;
+
+	float floorX = floor(sourceX);
+	float floorY = floor(sourceY);
+	int32 xInCylinderCoords = CLIP<int32>(int32(floorX), 0, _numColumns - 1);
+	int32 yInCylinderCoords = CLIP<int32>(int32(floorY), 0, _numRows - 1);
+
+	// Only store the (x,y) offsets instead of the absolute positions
+	_internalBuffer[index].x = xInCylinderCoords - x;
+	_internalBuffer[index].y = yInCylinderCoords - y;
 
+	// Drop the subpixel part where there is no neighbour to blend with
+	uint fracX = 0;
+	uint fracY = 0;
+	if (xInCylinderCoords == int32(floorX) && xInCylinderCoords < (int32)_numColumns - 1)
+		fracX = MIN<uint>(uint((sourceX - floorX) * kSubpixelScale), kSubpixelScale - 1);
+	if (yInCylinderCoords == int32(floorY) && yInCylinderCoords < (int32)_numRows - 1)
+		fracY = MIN<uint>(uint((sourceY - floorY) * kSubpixelScale), kSubpixelScale - 1);
+
+	_fractionBuffer[index] = fracX | (fracY << 8);
+}
+
+void RenderTable::generatePanoramaLookupTable() {
 	float halfWidth = (float)_numColumns / 2.0f;
 	float halfHeight = (float)_numRows / 2.0f;
 
@@ -162,20 +302,16 @@ void RenderTable::generatePanoramaLookupTable() {
 
 		// To get x in cylinder coordinates, we just need to calculate the arc length
 		// We also scale it by _panoramaOptions.linearScale
-		int32 xInCylinderCoords = int32(floor((cylinderRadius * _panoramaOptions.linearScale * alpha) + halfWidth));
+		float xInCylinderCoords = (cylinderRadius * _panoramaOptions.linearScale * alpha) + halfWidth;
 
 		float cosAlpha = cos(alpha);
 
 		for (uint y = 0; y < _numRows; ++y) {
 			// To calculate y in cylinder coordinates, we can do similar triangles comparison,
 			// comparing the triangle from the center to the screen and from the center to the edge of the cylinder
-			int32 yInCylinderCoords = int32(floor(halfHeight + ((float)y - halfHeight) * cosAlpha));
-
-			uint32 index = y * _numColumns + x;
+			float yInCylinderCoords = halfHeight + ((float)y - halfHeight) * cosAlpha;
 
-			// Only store the (x,y) offsets instead of the absolute positions
-			_internalBuffer[index].x = xInCylinderCoords - x;
-			_internalBuffer[index].y = yInCylinderCoords - y;
+			setSourceCoord(x, y, xInCylinderCoords, yInCylinderCoords);
 		}
 	}
 }
@@ -196,21 +332,16 @@ void RenderTable::generateTiltLookupTable() {
 
 		// To get y in cylinder coordinates, we just need to calculate the arc length
 		// We also scale it by _tiltOptions.linearScale
-		int32 yInCylinderCoords = int32(floor((cylinderRadius * _tiltOptions.linearScale * alpha) + halfHeight));
+		float yInCylinderCoords = (cylinderRadius * _tiltOptions.linearScale * alpha) + halfHeight;
 
 		float cosAlpha = cos(alpha);
-		uint32 columnIndex = y * _numColumns;
 
 		for (uint x = 0; x < _numColumns; ++x) {
 			// To calculate x in cylinder coordinates, we can do similar triangles comparison,
 			// comparing the triangle from the center to the screen and from the center to the edge of the cylinder
-			int32 xInCylinderCoords = int32(floor(halfWidth + ((float)x - halfWidth) * cosAlpha));
-
-			uint32 index = columnIndex + x;
+			float xInCylinderCoords = halfWidth + ((float)x - halfWidth) * cosAlpha;
 
-			// Only store the (x,y) offsets instead of the absolute positions
-			_internalBuffer[index].x = xInCylinderCoords - x;
-			_internalBuffer[index].y = yInCylinderCoords - y;
+			setSourceCoord(x, y, xInCylinderCoords, yInCylinderCoords);
 		}
 	}
 }
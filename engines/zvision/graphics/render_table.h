@@ -43,7 +43,18 @@ public:
 private:
 	uint _numColumns, _numRows;
 	Common::Point *_internalBuffer;
+	/**
+	 * Subpixel part of each offset in _internalBuffer, in 1/32 pixel:
+	 * x in the low byte and y in the high byte. Used for bilinear filtering.
+	 */
+	uint16 *_fractionBuffer;
 	RenderState _renderState;
+	bool _highQuality;
+
+	// Parameters the lookup table was last generated with
+	RenderState _generatedState;
+	float _generatedFoV;
+	float _generatedScale;
 
 	struct {
 		float fieldOfView;
@@ -66,6 +77,14 @@ public:
 	}
 	void setRenderState(RenderState newState);
 
+	/** Enables bilinear filtering of warped images */
+	void setHighQuality(bool highQuality) {
+		_highQuality = highQuality;
+	}
+	bool getHighQuality() const {
+		return _highQuality;
+	}
+
 	const Common::Point convertWarpedCoordToFlatCoord(const Common::Point &point);
 
 	void mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect);
@@ -88,8 +107,14 @@ public:
 	float getLinscale();
 
 private:
+	void setSourceCoord(uint x, uint y, float sourceX, float sourceY);
 	void generatePanoramaLookupTable();
 	void generateTiltLookupTable();
+
+	template<typename Pixel>
+	void mutateImageNearest(const Pixel *sourceBuffer, Pixel *destBuffer, uint32 sourcePitch, uint32 destPitch, uint16 width, uint16 height);
+	void mutateImageBilinear555(const uint16 *sourceBuffer, uint16 *destBuffer, uint32 sourcePitch, uint32 destPitch, uint16 width, uint16 height);
+	void mutateImageBilinear8888(const uint32 *sourceBuffer, uint32 *destBuffer, uint32 sourcePitch, uint32 destPitch, uint16 width, uint16 height);
 };
 
 } // End of namespace ZVision
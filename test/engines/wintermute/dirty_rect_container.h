@@ -0,0 +1,66 @@
+#include <cxxtest/TestSuite.h>
+#include "engines/wintermute/base/gfx/osystem/dirty_rect_container.h"
+
+/**
+ * Test suite for engines/wintermute/base/gfx/osystem/dirty_rect_container.h
+ */
+
+class DirtyRectContainerTestSuite : public CxxTest::TestSuite {
+	public:
+	const Common::Rect screen;
+
+	DirtyRectContainerTestSuite() : screen(0, 0, 640, 480) {
+	}
+
+	void test_clip() {
+		Wintermute::DirtyRectContainer dirty;
+		dirty.addDirtyRect(Common::Rect(-10, -10, 20, 20), screen);
+		TS_ASSERT_EQUALS(dirty.getRects().size(), 1u);
+		TS_ASSERT(dirty.getRects()[0] == Common::Rect(0, 0, 20, 20));
+
+		dirty.reset();
+		dirty.addDirtyRect(Common::Rect(700, 0, 720, 20), screen);
+		TS_ASSERT(dirty.isEmpty());
+	}
+
+	void test_overlapping_rects_merge() {
+		Wintermute::DirtyRectContainer dirty;
+		dirty.addDirtyRect(Common::Rect(0, 0, 100, 100), screen);
+		dirty.addDirtyRect(Common::Rect(50, 50, 150, 150), screen);
+		TS_ASSERT_EQUALS(dirty.getRects().size(), 1u);
+		TS_ASSERT(dirty.getRects()[0] == Common::Rect(0, 0, 150, 150));
+	}
+
+	void test_distant_rects_stay_apart() {
+		Wintermute::DirtyRectContainer dirty;
+		dirty.addDirtyRect(Common::Rect(0, 0, 10, 10), screen);
+		dirty.addDirtyRect(Common::Rect(600, 400, 640, 480), screen);
+		TS_ASSERT_EQUALS(dirty.getRects().size(), 2u);
+	}
+
+	void test_merge_cascades() {
+		Wintermute::DirtyRectContainer dirty;
+		dirty.addDirtyRect(Common::Rect(0, 0, 10, 10), screen);
+		dirty.addDirtyRect(Common::Rect(100, 0, 110, 10), screen);
+		// Bridges both rects, which then have to end up as one.
+		dirty.addDirtyRect(Common::Rect(5, 0, 105, 10), screen);
+		TS_ASSERT_EQUALS(dirty.getRects().size(), 1u);
+		TS_ASSERT(dirty.getRects()[0] == Common::Rect(0, 0, 110, 10));
+	}
+
+	void test_rects_are_disjoint() {
+		Wintermute::DirtyRectContainer dirty;
+		for (int i = 0; i < 40; i++) {
+			int x = (i * 97) % 600;
+			int y = (i * 61) % 440;
+			dirty.addDirtyRect(Common::Rect(x, y, x + 30, y + 30), screen);
+		}
+		const Common::Array<Common::Rect> &rects = dirty.getRects();
+		TS_ASSERT_LESS_THAN_EQUALS(rects.size(), Wintermute::DirtyRectContainer::kMaxRects);
+		for (uint i = 0; i < rects.size(); i++) {
+			for (uint j = i + 1; j < rects.size(); j++) {
+				TS_ASSERT(!rects[i].intersects(rects[j]));
+			}
+		}
+	}
+};
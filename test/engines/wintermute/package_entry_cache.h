@@ -0,0 +1,86 @@
+#include <cxxtest/TestSuite.h>
+#include "engines/wintermute/base/file/package_entry_cache.h"
+
+/**
+ * Test suite for engines/wintermute/base/file/package_entry_cache.h
+ */
+
+class PackageEntryCacheTestSuite : public CxxTest::TestSuite {
+	public:
+	// Only used as keys, never dereferenced
+	const Wintermute::BasePackage *package1;
+	const Wintermute::BasePackage *package2;
+
+	PackageEntryCacheTestSuite() :
+		package1(reinterpret_cast<const Wintermute::BasePackage *>(0x1000)),
+		package2(reinterpret_cast<const Wintermute::BasePackage *>(0x2000)) {
+	}
+
+	static byte *makeData(uint32 size, byte value) {
+		byte *data = new byte[size];
+		memset(data, value, size);
+		return data;
+	}
+
+	void test_hit_after_insert() {
+		Wintermute::PackageEntryCache cache(1024);
+		TS_ASSERT(!cache.createReadStream(package1, 0));
+
+		Common::SeekableReadStream *stream = cache.insert(package1, 0, makeData(16, 7), 16);
+		TS_ASSERT_EQUALS(stream->size(), 16);
+		delete stream;
+
+		stream = cache.createReadStream(package1, 0);
+		TS_ASSERT(stream);
+		TS_ASSERT_EQUALS(stream->size(), 16);
+		TS_ASSERT_EQUALS(stream->readByte(), 7);
+		delete stream;
+
+		TS_ASSERT(!cache.createReadStream(package2, 0));
+		TS_ASSERT_EQUALS(cache.getStats().hits, 1u);
+		TS_ASSERT_EQUALS(cache.getStats().misses, 2u);
+	}
+
+	void test_least_recently_used_is_evicted() {
+		Wintermute::PackageEntryCache cache(64);
+		delete cache.insert(package1, 0, makeData(16, 1), 16);
+		delete cache.insert(package1, 16, makeData(16, 2), 16);
+		delete cache.insert(package1, 32, makeData(16, 3), 16);
+		// Touch the first entry so the second one is the oldest
+		delete cache.createReadStream(package1, 0);
+		delete cache.insert(package1, 48, makeData(32, 4), 32);
+
+		TS_ASSERT_EQUALS(cache.getStats().evictions, 1u);
+		TS_ASSERT_EQUALS(cache.getStats().bytes, 64u);
+		Common::SeekableReadStream *stream = cache.createReadStream(package1, 16);
+		TS_ASSERT(!stream);
+		stream = cache.createReadStream(package1, 0);
+		TS_ASSERT(stream);
+		delete stream;
+	}
+
+	void test_stream_outlives_eviction() {
+		Wintermute::PackageEntryCache cache(16);
+		Common::SeekableReadStream *stream = cache.insert(package1, 0, makeData(16, 5), 16);
+		delete cache.insert(package1, 16, makeData(16, 6), 16);
+		TS_ASSERT(!cache.createReadStream(package1, 0));
+
+		stream->seek(15);
+		TS_ASSERT_EQUALS(stream->readByte(), 5);
+		delete stream;
+	}
+
+	void test_invalidate_package() {
+		Wintermute::PackageEntryCache cache(1024);
+		delete cache.insert(package1, 0, makeData(16, 1), 16);
+		delete cache.insert(package2, 0, makeData(16, 2), 16);
+		cache.invalidatePackage(package1);
+
+		TS_ASSERT_EQUALS(cache.getNumEntries(), 1u);
+		TS_ASSERT_EQUALS(cache.getStats().bytes, 16u);
+		TS_ASSERT(!cache.createReadStream(package1, 0));
+		Common::SeekableReadStream *stream = cache.createReadStream(package2, 0);
+		TS_ASSERT(stream);
+		delete stream;
+	}
+};
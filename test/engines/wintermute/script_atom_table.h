@@ -0,0 +1,49 @@
+#include <cxxtest/TestSuite.h>
+#include "engines/wintermute/base/scriptables/script_atom_table.h"
+
+/**
+ * Test suite for engines/wintermute/base/scriptables/script_atom_table.h
+ */
+
+class ScAtomTableTestSuite : public CxxTest::TestSuite {
+	public:
+	void test_acquire_same_name() {
+		Wintermute::ScAtomTable table;
+		Wintermute::ScAtom a = table.acquire("Name");
+		Wintermute::ScAtom b = table.acquire(Common::String("Name"));
+		TS_ASSERT_EQUALS(a, b);
+		TS_ASSERT_EQUALS(table.getName(a), "Name");
+		TS_ASSERT_EQUALS(table.getNumAtoms(), 1u);
+		TS_ASSERT_DIFFERS(table.acquire("Other"), a);
+	}
+
+	void test_find_does_not_create() {
+		Wintermute::ScAtomTable table;
+		Wintermute::ScAtom atom;
+		TS_ASSERT(!table.find("Missing", atom));
+		TS_ASSERT_EQUALS(table.getNumAtoms(), 0u);
+
+		Wintermute::ScAtom name = table.acquire("Name");
+		TS_ASSERT(table.find("Name", atom));
+		TS_ASSERT_EQUALS(atom, name);
+	}
+
+	void test_release_frees_atom() {
+		Wintermute::ScAtomTable table;
+		Wintermute::ScAtom a = table.acquire("0");
+		table.addRef(a);
+		table.release(a);
+
+		Wintermute::ScAtom atom;
+		TS_ASSERT(table.find("0", atom));
+
+		table.release(a);
+		TS_ASSERT(!table.find("0", atom));
+		TS_ASSERT_EQUALS(table.getNumAtoms(), 0u);
+
+		// The freed number is reused instead of growing the table
+		Wintermute::ScAtom b = table.acquire("1");
+		TS_ASSERT_EQUALS(a, b);
+		TS_ASSERT_EQUALS(table.getName(b), "1");
+	}
+};